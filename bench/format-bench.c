@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 The tmux authors
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF MIND, USE, DATA OR PROFITS, WHETHER
+ * IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING
+ * OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * Measure format expansion: expand the list-windows format for every window
+ * of a session, as list-windows does, and the first line of status-format
+ * for the session, as the status line does. For example:
+ *
+ *	bench/format-bench -n100 -w1000
+ *
+ * Any formats given are expanded for each window instead of the list-windows
+ * format.
+ */
+
+#include <sys/types.h>
+
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "tmux.h"
+#include "bench.h"
+
+#define BENCH_LIST_WINDOWS					\
+	"#{window_index}: #{window_name}#{window_raw_flags} "	\
+	"(#{window_panes} panes) "				\
+	"[#{window_width}x#{window_height}] "			\
+	"[layout #{window_layout}] #{window_id}"		\
+	"#{?window_active, (active),}"
+
+static __dead void
+usage(void)
+{
+	fprintf(stderr, "usage: %s [-n count] [-w windows] [format ...]\n",
+	    getprogname());
+	exit(1);
+}
+
+/* Print the time and allocations taken for a number of expansions. */
+static void
+bench_report(const char *name, u_int count, uint64_t msec, u_long allocations)
+{
+	printf("%s: %u expansions: %.2f us each", name, count,
+	    (double)msec * 1000 / count);
+#ifdef BENCH_COUNT_ALLOCATIONS
+	printf(", %.1f allocations each", (double)allocations / count);
+#endif
+	printf("\n");
+}
+
+/* Expand a format for every window, as list-windows does. */
+static void
+bench_windows(struct session *s, const char *name, const char *fmt,
+    u_int count)
+{
+	struct format_tree	*ft;
+	struct winlink		*wl;
+	uint64_t		 start;
+	u_long			 allocations;
+	u_int			 i, n = 0;
+
+	allocations = bench_allocations;
+	start = get_timer();
+	for (i = 0; i < count; i++) {
+		RB_FOREACH(wl, winlinks, &s->windows) {
+			ft = format_create(NULL, NULL,
+			    FORMAT_WINDOW|wl->window->id, 0);
+			format_defaults(ft, NULL, s, wl, NULL);
+			free(format_expand(ft, fmt));
+			format_free(ft);
+			n++;
+		}
+	}
+	bench_report(name, n, get_timer() - start,
+	    bench_allocations - allocations);
+}
+
+/* Expand the first status line for the session. */
+static void
+bench_status(struct session *s, u_int count)
+{
+	struct options_entry	*o;
+	struct format_tree	*ft;
+	const char		*fmt;
+	uint64_t		 start;
+	u_long			 allocations;
+	u_int			 i;
+
+	o = options_get(s->options, "status-format");
+	fmt = options_array_get(o, 0)->string;
+
+	allocations = bench_allocations;
+	start = get_timer();
+	for (i = 0; i < count; i++) {
+		ft = format_create(NULL, NULL, FORMAT_STATUS, FORMAT_STATUS);
+		format_defaults(ft, NULL, s, NULL, NULL);
+		free(format_expand_time(ft, fmt));
+		format_free(ft);
+	}
+	bench_report("status-format[0]", count, get_timer() - start,
+	    bench_allocations - allocations);
+}
+
+int
+main(int argc, char **argv)
+{
+	const struct options_table_entry	*oe;
+	struct window				*w;
+	struct window_pane			*wp;
+	struct winlink				*wl;
+	struct session				*s;
+	struct environ				*env;
+	const char				*errstr;
+	char					*cause;
+	int					 opt;
+	u_int					 count = 10, nwindows = 1000, i;
+
+	setlocale(LC_CTYPE, "");
+	while ((opt = getopt(argc, argv, "n:vw:")) != -1) {
+		switch (opt) {
+		case 'n':
+			count = strtonum(optarg, 1, UINT_MAX, &errstr);
+			if (errstr != NULL)
+				errx(1, "count %s", errstr);
+			break;
+		case 'v':
+			log_add_level();
+			break;
+		case 'w':
+			nwindows = strtonum(optarg, 1, INT_MAX, &errstr);
+			if (errstr != NULL)
+				errx(1, "windows %s", errstr);
+			break;
+		default:
+			usage();
+		}
+	}
+	argc -= optind;
+	argv += optind;
+
+	socket_path = xstrdup(_PATH_DEVNULL);
+	global_environ = environ_create();
+	global_options = options_create(NULL);
+	global_s_options = options_create(NULL);
+	global_w_options = options_create(NULL);
+	for (oe = options_table; oe->name != NULL; oe++) {
+		if (oe->scope & OPTIONS_TABLE_SERVER)
+			options_default(global_options, oe);
+		if (oe->scope & OPTIONS_TABLE_SESSION)
+			options_default(global_s_options, oe);
+		if (oe->scope & OPTIONS_TABLE_WINDOW)
+			options_default(global_w_options, oe);
+	}
+	osdep_event_init();
+	server_proc = proc_start("bench");
+
+	RB_INIT(&windows);
+	RB_INIT(&all_window_panes);
+	TAILQ_INIT(&clients);
+	RB_INIT(&sessions);
+	gettimeofday(&start_time, NULL);
+
+	env = environ_create();
+	s = session_create(NULL, "bench", "/", env,
+	    options_create(global_s_options), NULL);
+	for (i = 0; i < nwindows; i++) {
+		w = window_create(80, 24, 0, 0);
+		window_set_name(w, "bench");
+		wp = window_add_pane(w, NULL, 0, 0);
+		layout_init(w, wp);
+		window_set_active_pane(w, wp, 0);
+		if ((wl = session_attach(s, w, -1, &cause)) == NULL)
+			errx(1, "%s", cause);
+	}
+	session_select(s, RB_MIN(winlinks, &s->windows)->idx);
+
+	if (argc == 0)
+		bench_windows(s, "list-windows", BENCH_LIST_WINDOWS, count);
+	for (i = 0; i < (u_int)argc; i++)
+		bench_windows(s, argv[i], argv[i], count);
+	bench_status(s, count);
+	return (0);
+}
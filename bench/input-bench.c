@@ -0,0 +1,563 @@
+/*
+ * Copyright (c) 2026 The tmux authors
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF MIND, USE, DATA OR PROFITS, WHETHER
+ * IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING
+ * OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * Measure the pane input pipeline: replay files through input_parse_buffer
+ * into a pane of a session with zero or more attached clients, each with a
+ * pseudo-terminal which is drained as a real terminal would be. For example:
+ *
+ *	bench/input-bench -c1 -n100 tools/UTF-8-demo.txt tools/ansicode.txt
+ *
+ * For each file this reports the input rate, the number of allocations, the
+ * bytes written to (and discarded instead of written to) the terminals and
+ * the memory used by the history of the pane. With -l, the history limit is
+ * changed so the memory for a large history may be measured, for example:
+ *
+ *	bench/input-bench -l100000 -n500 tools/UTF-8-demo.txt
+ *
+ * With -r, the clients are then made to redraw the whole screen a number of
+ * times (as after a resize) and the CPU time, write system calls and bytes
+ * for each redraw are reported.
+ *
+ * With -e, each file is instead escaped for control mode %output a block at a
+ * time, and the rate is reported both for control_escape_data and for the
+ * original loop which escaped a byte at a time with evbuffer_add_printf.
+ */
+
+#include <sys/types.h>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+#ifdef __GLIBC__
+#include <sys/syscall.h>
+#endif
+
+#include <fcntl.h>
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "tmux.h"
+#include "bench.h"
+
+#define BENCH_MAX_CLIENTS 16
+
+struct bench_client {
+	struct client	*c;
+	int		 master;
+
+	size_t		 received;
+	size_t		 written;
+	size_t		 discarded;
+};
+
+static struct bench_client	 bench_clients[BENCH_MAX_CLIENTS];
+static u_int			 bench_nclients;
+static u_long			 bench_writes;
+
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__)
+/*
+ * Count writes to the client terminals by wrapping the C library write and
+ * writev and making the system calls directly.
+ */
+ssize_t	write(int, const void *, size_t);
+ssize_t	writev(int, const struct iovec *, int);
+
+static void
+bench_count_write(int fd)
+{
+	u_int	i;
+
+	for (i = 0; i < bench_nclients; i++) {
+		if (bench_clients[i].c->fd == fd)
+			bench_writes++;
+	}
+}
+
+ssize_t
+write(int fd, const void *buf, size_t len)
+{
+	bench_count_write(fd);
+	return (syscall(SYS_write, fd, buf, len));
+}
+
+ssize_t
+writev(int fd, const struct iovec *iov, int iovcnt)
+{
+	bench_count_write(fd);
+	return (syscall(SYS_writev, fd, iov, iovcnt));
+}
+#define BENCH_COUNT_WRITES
+#endif
+
+static __dead void
+usage(void)
+{
+	fprintf(stderr, "usage: %s [-e] [-c clients] [-l lines] [-n count] "
+	    "[-r redraws] [-s size] [-T term] [-x width] [-y height] "
+	    "file ...\n", getprogname());
+	exit(1);
+}
+
+/* Read whatever has been written to the client terminals. */
+static void
+bench_drain(void)
+{
+	struct bench_client	*bc;
+	char			 buf[BUFSIZ];
+	ssize_t			 n;
+	u_int			 i;
+
+	for (i = 0; i < bench_nclients; i++) {
+		bc = &bench_clients[i];
+		while ((n = read(bc->master, buf, sizeof buf)) > 0)
+			bc->received += n;
+	}
+}
+
+/* Run the event loop and server loop until there is nothing left to do. */
+static void
+bench_loop(void)
+{
+	struct client	*c;
+	int		 busy;
+	u_int		 i;
+
+	do {
+		while (cmdq_next(NULL) != 0)
+			;
+		TAILQ_FOREACH(c, &clients, entry)
+			cmdq_next(c);
+		server_client_loop();
+		if (event_loop(EVLOOP_NONBLOCK) == -1)
+			errx(1, "event_loop failed");
+		bench_drain();
+
+		busy = 0;
+		for (i = 0; i < bench_nclients; i++) {
+			c = bench_clients[i].c;
+			if (tty_output_length(&c->tty) != 0)
+				busy = 1;
+		}
+	} while (busy);
+}
+
+/* Attach a client with a pseudo-terminal to a session. */
+static void
+bench_attach(struct session *s, const char *term, u_int sx, u_int sy)
+{
+	struct bench_client	*bc = &bench_clients[bench_nclients];
+	struct client		*c;
+	struct winsize		 ws;
+	int			 pair[2], fd;
+	char			*name, *cause;
+
+	bc->master = posix_openpt(O_RDWR|O_NOCTTY);
+	if (bc->master == -1 ||
+	    grantpt(bc->master) != 0 ||
+	    unlockpt(bc->master) != 0)
+		err(1, "posix_openpt");
+	if ((fd = open(ptsname(bc->master), O_RDWR|O_NOCTTY)) == -1)
+		err(1, "open");
+	setblocking(bc->master, 0);
+
+	memset(&ws, 0, sizeof ws);
+	ws.ws_col = sx;
+	ws.ws_row = sy;
+	if (ioctl(fd, TIOCSWINSZ, &ws) == -1)
+		err(1, "ioctl");
+
+	if (socketpair(AF_UNIX, SOCK_STREAM, PF_UNSPEC, pair) != 0)
+		err(1, "socketpair");
+	c = bc->c = server_client_create(pair[0]);
+	xasprintf(&name, "bench%u", bench_nclients);
+	c->name = name;
+	c->fd = fd;
+	c->term_name = xstrdup(term);
+	if (tty_term_read_list(term, fd, &c->term_caps, &c->term_ncaps,
+	    &cause) != 0)
+		errx(1, "%s", cause);
+
+	if (tty_init(&c->tty, c) != 0)
+		errx(1, "tty_init failed");
+	tty_resize(&c->tty);
+	c->flags |= (CLIENT_TERMINAL|CLIENT_ATTACHED);
+	if (tty_open(&c->tty, &cause) != 0)
+		errx(1, "%s", cause);
+
+	s->attached++;
+	server_client_set_session(c, s);
+
+	bench_nclients++;
+}
+
+/* Read a whole file. */
+static u_char *
+bench_read(const char *path, size_t *size)
+{
+	struct stat	 sb;
+	u_char		*buf;
+	size_t		 done;
+	ssize_t		 n;
+	int		 fd;
+
+	if ((fd = open(path, O_RDONLY)) == -1 || fstat(fd, &sb) != 0)
+		err(1, "%s", path);
+	buf = xmalloc(sb.st_size + 1);
+	for (done = 0; done < (size_t)sb.st_size; done += n) {
+		n = read(fd, buf + done, sb.st_size - done);
+		if (n <= 0)
+			err(1, "%s", path);
+	}
+	close(fd);
+	*size = done;
+	return (buf);
+}
+
+/* Escape data for control mode a byte at a time, as tmux once did. */
+static void
+bench_escape_bytes(struct evbuffer *message, const u_char *data, size_t size)
+{
+	size_t	i;
+
+	for (i = 0; i < size; i++) {
+		if (data[i] < ' ' || data[i] == '\\')
+			evbuffer_add_printf(message, "\\%03o", data[i]);
+		else
+			evbuffer_add_printf(message, "%c", data[i]);
+	}
+}
+
+/* Escape one file for control mode with each method and compare them. */
+static void
+bench_escape(const char *path, u_int count, size_t size)
+{
+	static const struct {
+		const char	*name;
+		void		 (*escape)(struct evbuffer *, const u_char *,
+				     size_t);
+	} methods[] = {
+		{ "control_escape_data", control_escape_data },
+		{ "byte at a time", bench_escape_bytes }
+	};
+	struct evbuffer	*message, *out[nitems(methods)];
+	u_char		*buf;
+	uint64_t	 start, msec;
+	size_t		 done, total, n;
+	u_int		 i, j;
+
+	buf = bench_read(path, &total);
+	if ((message = evbuffer_new()) == NULL)
+		fatalx("out of memory");
+
+	for (i = 0; i < nitems(methods); i++) {
+		if ((out[i] = evbuffer_new()) == NULL)
+			fatalx("out of memory");
+		methods[i].escape(out[i], buf, total);
+
+		start = get_timer();
+		for (j = 0; j < count; j++) {
+			for (done = 0; done < total; done += n) {
+				n = total - done;
+				if (n > size)
+					n = size;
+				methods[i].escape(message, buf + done, n);
+				evbuffer_drain(message,
+				    EVBUFFER_LENGTH(message));
+			}
+		}
+		msec = get_timer() - start;
+
+		printf("%s: %zu bytes x %u, %s: %.1f MB/s\n", path, total,
+		    count, methods[i].name,
+		    msec == 0 ? 0 : (double)total * count / msec / 1000);
+	}
+
+	for (i = 1; i < nitems(methods); i++) {
+		if (EVBUFFER_LENGTH(out[i]) != EVBUFFER_LENGTH(out[0]) ||
+		    memcmp(EVBUFFER_DATA(out[i]), EVBUFFER_DATA(out[0]),
+		    EVBUFFER_LENGTH(out[0])) != 0)
+			errx(1, "%s: %s output differs", path, methods[i].name);
+	}
+	for (i = 0; i < nitems(methods); i++)
+		evbuffer_free(out[i]);
+	evbuffer_free(message);
+	free(buf);
+}
+
+/* Replay one file through the pane. */
+static void
+bench_file(struct window_pane *wp, const char *path, u_int count,
+    size_t size)
+{
+	struct bench_client	*bc;
+	struct rusage		 ru;
+	u_char			*buf;
+	char			*history;
+	uint64_t		 start, msec;
+	u_long			 allocations;
+	size_t			 done, total, received, written, discarded;
+	ssize_t			 n;
+	u_int			 i;
+
+	buf = bench_read(path, &total);
+
+	for (i = 0; i < bench_nclients; i++) {
+		bc = &bench_clients[i];
+		bc->received = 0;
+		bc->written = bc->c->written;
+		bc->discarded = bc->c->discarded;
+	}
+
+	allocations = bench_allocations;
+	start = get_timer();
+	for (i = 0; i < count; i++) {
+		for (done = 0; done < total; done += n) {
+			n = total - done;
+			if ((size_t)n > size)
+				n = size;
+			input_parse_buffer(wp, buf + done, n);
+			bench_loop();
+		}
+	}
+	msec = get_timer() - start;
+	allocations = bench_allocations - allocations;
+	free(buf);
+
+	received = written = discarded = 0;
+	for (i = 0; i < bench_nclients; i++) {
+		bc = &bench_clients[i];
+		received += bc->received;
+		written += bc->c->written - bc->written;
+		discarded += bc->c->discarded - bc->discarded;
+	}
+
+	printf("%s: %zu bytes x %u, %u clients: %.1f MB/s", path, total,
+	    count, bench_nclients,
+	    msec == 0 ? 0 : (double)total * count / msec / 1000);
+#ifdef BENCH_COUNT_ALLOCATIONS
+	printf(", %lu allocations", allocations);
+#endif
+	if (bench_nclients != 0) {
+		printf(", %zu bytes to terminal (%zu written, %zu discarded)",
+		    received, written, discarded);
+	}
+
+	history = format_single(NULL, "#{history_size} lines, #{history_bytes}",
+	    NULL, NULL, NULL, wp);
+	getrusage(RUSAGE_SELF, &ru);
+	printf(", history %s bytes, maximum RSS %ld KB\n", history,
+	    ru.ru_maxrss);
+	free(history);
+}
+
+/* Redraw the whole screen of every client. */
+static void
+bench_redraw(u_int count)
+{
+	struct bench_client	*bc;
+	struct client		*c;
+	struct rusage		 ru0, ru1;
+	struct timeval		 tv;
+	u_long			 writes;
+	size_t			 received;
+	double			 n;
+	u_int			 i, j;
+
+	for (i = 0; i < bench_nclients; i++)
+		bench_clients[i].received = 0;
+
+	writes = bench_writes;
+	getrusage(RUSAGE_SELF, &ru0);
+	for (i = 0; i < count; i++) {
+		for (j = 0; j < bench_nclients; j++)
+			tty_invalidate(&bench_clients[j].c->tty);
+		bench_loop();
+		for (j = 0; j < bench_nclients; j++) {
+			c = bench_clients[j].c;
+			server_redraw_client(c);
+		}
+		bench_loop();
+	}
+	getrusage(RUSAGE_SELF, &ru1);
+	writes = bench_writes - writes;
+
+	timersub(&ru1.ru_utime, &ru0.ru_utime, &ru1.ru_utime);
+	timersub(&ru1.ru_stime, &ru0.ru_stime, &ru1.ru_stime);
+	timeradd(&ru1.ru_utime, &ru1.ru_stime, &tv);
+
+	received = 0;
+	for (i = 0; i < bench_nclients; i++) {
+		bc = &bench_clients[i];
+		received += bc->received;
+	}
+
+	n = (double)count * bench_nclients;
+	printf("redraw: %u x %u clients: %.1f us CPU", count, bench_nclients,
+	    (tv.tv_sec * 1000000.0 + tv.tv_usec) / n);
+#ifdef BENCH_COUNT_WRITES
+	printf(", %.1f writes", writes / n);
+#endif
+	printf(", %.0f bytes each\n", received / n);
+}
+
+int
+main(int argc, char **argv)
+{
+	const struct options_table_entry	*oe;
+	struct event_base			*base;
+	struct bufferevent			*vpty[2];
+	struct window				*w;
+	struct window_pane			*wp;
+	struct winlink				*wl;
+	struct session				*s;
+	struct environ				*env;
+	const char				*term = "screen-256color";
+	const char				*errstr;
+	char					*cause;
+	int					 opt, escape = 0;
+	u_int					 nclients = 0, count = 10, i;
+	u_int					 redraws = 0;
+	u_int					 sx = 80, sy = 24, lines;
+	u_int					 history = 0;
+	size_t					 size = 4096;
+
+	setlocale(LC_CTYPE, "");
+	while ((opt = getopt(argc, argv, "c:el:n:r:s:T:vx:y:")) != -1) {
+		switch (opt) {
+		case 'c':
+			nclients = strtonum(optarg, 0, BENCH_MAX_CLIENTS,
+			    &errstr);
+			if (errstr != NULL)
+				errx(1, "clients %s", errstr);
+			break;
+		case 'e':
+			escape = 1;
+			break;
+		case 'l':
+			history = strtonum(optarg, 0, INT_MAX, &errstr);
+			if (errstr != NULL)
+				errx(1, "lines %s", errstr);
+			break;
+		case 'n':
+			count = strtonum(optarg, 1, UINT_MAX, &errstr);
+			if (errstr != NULL)
+				errx(1, "count %s", errstr);
+			break;
+		case 'r':
+			redraws = strtonum(optarg, 0, UINT_MAX, &errstr);
+			if (errstr != NULL)
+				errx(1, "redraws %s", errstr);
+			break;
+		case 's':
+			size = strtonum(optarg, 1, INT_MAX, &errstr);
+			if (errstr != NULL)
+				errx(1, "size %s", errstr);
+			break;
+		case 'T':
+			term = optarg;
+			break;
+		case 'v':
+			log_add_level();
+			break;
+		case 'x':
+			sx = strtonum(optarg, WINDOW_MINIMUM, WINDOW_MAXIMUM,
+			    &errstr);
+			if (errstr != NULL)
+				errx(1, "width %s", errstr);
+			break;
+		case 'y':
+			sy = strtonum(optarg, WINDOW_MINIMUM, WINDOW_MAXIMUM,
+			    &errstr);
+			if (errstr != NULL)
+				errx(1, "height %s", errstr);
+			break;
+		default:
+			usage();
+		}
+	}
+	argc -= optind;
+	argv += optind;
+	if (argc == 0)
+		usage();
+
+	if (escape) {
+		for (i = 0; i < (u_int)argc; i++)
+			bench_escape(argv[i], count, size);
+		return (0);
+	}
+
+	socket_path = xstrdup(_PATH_DEVNULL);
+	global_environ = environ_create();
+	global_options = options_create(NULL);
+	global_s_options = options_create(NULL);
+	global_w_options = options_create(NULL);
+	for (oe = options_table; oe->name != NULL; oe++) {
+		if (oe->scope & OPTIONS_TABLE_SERVER)
+			options_default(global_options, oe);
+		if (oe->scope & OPTIONS_TABLE_SESSION)
+			options_default(global_s_options, oe);
+		if (oe->scope & OPTIONS_TABLE_WINDOW)
+			options_default(global_w_options, oe);
+	}
+	options_set_number(global_options, "redraw-rate", 0);
+	if (history != 0)
+		options_set_number(global_s_options, "history-limit", history);
+	base = osdep_event_init();
+	server_proc = proc_start("bench");
+
+	input_key_build();
+	utf8_update_width_cache();
+	RB_INIT(&windows);
+	RB_INIT(&all_window_panes);
+	TAILQ_INIT(&clients);
+	RB_INIT(&sessions);
+	key_bindings_init();
+	TAILQ_INIT(&message_log);
+	gettimeofday(&start_time, NULL);
+
+	env = environ_create();
+	s = session_create(NULL, "bench", "/", env,
+	    options_create(global_s_options), NULL);
+	w = window_create(sx, sy, 0, 0);
+	wp = window_add_pane(w, NULL, options_get_number(s->options,
+	    "history-limit"), 0);
+	layout_init(w, wp);
+	window_set_active_pane(w, wp, 0);
+	if ((wl = session_attach(s, w, 0, &cause)) == NULL)
+		errx(1, "%s", cause);
+	session_select(s, wl->idx);
+
+	bufferevent_pair_new(base, BEV_OPT_CLOSE_ON_FREE, vpty);
+	wp->ictx = input_init(wp, vpty[0], NULL);
+
+	lines = options_get_number(s->options, "status");
+	for (i = 0; i < nclients; i++)
+		bench_attach(s, term, sx, sy + lines);
+	bench_loop();
+
+	for (i = 0; i < (u_int)argc; i++)
+		bench_file(wp, argv[i], count, size);
+	if (redraws != 0 && bench_nclients != 0)
+		bench_redraw(redraws);
+	return (0);
+}
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2026 The tmux authors
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF MIND, USE, DATA OR PROFITS, WHETHER
+ * IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING
+ * OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * Measure copy mode search: fill the history of a pane with lines of text,
+ * every thousandth of which contains "needle", then search for each string
+ * given, both as a regular expression and as plain text. For example:
+ *
+ *	bench/search-bench -l500000 needle 'ne+dle'
+ *
+ * For each search this reports the time to enter copy mode and search
+ * backward from the bottom, the time taken to count every match in the
+ * background, and the time for search-again and search-reverse.
+ *
+ * The history is filled until it holds the number of lines given with -l.
+ * With -w, each line of text is padded to the given length so it wraps.
+ */
+
+#include <sys/types.h>
+
+#include <locale.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "tmux.h"
+
+static struct session		*bench_s;
+static struct winlink		*bench_wl;
+static struct window_pane	*bench_wp;
+
+static __dead void
+usage(void)
+{
+	fprintf(stderr, "usage: %s [-l lines] [-n count] [-w width] "
+	    "[-x width] [-y height] string ...\n", getprogname());
+	exit(1);
+}
+
+/* Get the time in microseconds. */
+static uint64_t
+bench_time(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000ULL);
+}
+
+/* Run the event loop and server loop until there is nothing left to do. */
+static void
+bench_loop(void)
+{
+	while (cmdq_next(NULL) != 0)
+		;
+	server_client_loop();
+	if (event_loop(EVLOOP_NONBLOCK) == -1)
+		errx(1, "event_loop failed");
+}
+
+/* Run a command with the pane as target. */
+static void
+bench_command(const char *name, ...)
+{
+	struct cmd_parse_result	*pr;
+	struct args_value	*values;
+	va_list			 ap;
+	char			*argv[8], target[16];
+	int			 argc = 0;
+
+	xsnprintf(target, sizeof target, "%%%u", bench_wp->id);
+	argv[argc++] = (char *)name;
+	argv[argc++] = (char *)"-t";
+	argv[argc++] = target;
+	va_start(ap, name);
+	while (argc < (int)nitems(argv) &&
+	    (argv[argc] = va_arg(ap, char *)) != NULL)
+		argc++;
+	va_end(ap);
+
+	values = args_from_vector(argc, argv);
+	pr = cmd_parse_from_arguments(values, argc, NULL);
+	if (pr->status != CMD_PARSE_SUCCESS)
+		errx(1, "%s", pr->error);
+	args_free_values(values, argc);
+	free(values);
+	cmdq_append(NULL, cmdq_get_command(pr->cmdlist, NULL));
+	cmd_list_free(pr->cmdlist);
+	while (cmdq_next(NULL) != 0)
+		;
+}
+
+/* Expand a format for the pane and return it as a number. */
+static u_int
+bench_format(const char *fmt)
+{
+	char	*value;
+	u_int	 n;
+
+	value = format_single(NULL, fmt, NULL, bench_s, bench_wl, bench_wp);
+	n = strtoul(value, NULL, 10);
+	free(value);
+	return (n);
+}
+
+/* Fill the history with lines of text until it is full. */
+static void
+bench_fill(u_int lines, u_int width)
+{
+	struct evbuffer	*evb;
+	u_int		 i, sx = screen_size_x(&bench_wp->base), rows = 0;
+	int		 n;
+
+	evb = evbuffer_new();
+	if (evb == NULL)
+		fatalx("out of memory");
+	for (i = 0; rows < lines + screen_size_y(&bench_wp->base); i++) {
+		n = evbuffer_add_printf(evb, "line %u some text to search %s",
+		    i, (i % 1000 == 0) ? "needle" : "hay");
+		for (; n > 0 && (u_int)n < width; n++)
+			evbuffer_add(evb, ".", 1);
+		evbuffer_add(evb, "\r\n", 2);
+		rows += (n + sx - 1) / sx;
+
+		if (EVBUFFER_LENGTH(evb) >= 65536) {
+			input_parse_buffer(bench_wp, EVBUFFER_DATA(evb),
+			    EVBUFFER_LENGTH(evb));
+			evbuffer_drain(evb, EVBUFFER_LENGTH(evb));
+			bench_loop();
+		}
+	}
+	input_parse_buffer(bench_wp, EVBUFFER_DATA(evb), EVBUFFER_LENGTH(evb));
+	evbuffer_free(evb);
+	bench_loop();
+}
+
+/* Time searches for one string. */
+static void
+bench_search(const char *string, int regex, u_int count)
+{
+	const char	*backward, *type;
+	uint64_t	 start, search = 0, matches = 0, again, reverse;
+	u_int		 i, found;
+
+	if (regex) {
+		backward = "search-backward";
+		type = "regex";
+	} else {
+		backward = "search-backward-text";
+		type = "text";
+	}
+
+	for (i = 0; i < count; i++) {
+		window_pane_reset_mode_all(bench_wp);
+		start = bench_time();
+		bench_command("copy-mode", NULL);
+		bench_command("send-keys", "-X", backward, string, NULL);
+		search += bench_time() - start;
+
+		start = bench_time();
+		while (bench_format("#{search_count_partial}"))
+			bench_loop();
+		matches += bench_time() - start;
+	}
+	found = bench_format("#{search_count}");
+
+	start = bench_time();
+	for (i = 0; i < count; i++)
+		bench_command("send-keys", "-X", "search-again", NULL);
+	again = bench_time() - start;
+
+	start = bench_time();
+	for (i = 0; i < count; i++)
+		bench_command("send-keys", "-X", "search-reverse", NULL);
+	reverse = bench_time() - start;
+
+	printf("%s (%s): search %.2f ms, %u matches counted in %.2f ms, "
+	    "search-again %.3f ms, search-reverse %.3f ms\n", string, type,
+	    search / 1000.0 / count, found, matches / 1000.0 / count,
+	    again / 1000.0 / count, reverse / 1000.0 / count);
+}
+
+int
+main(int argc, char **argv)
+{
+	const struct options_table_entry	*oe;
+	struct event_base			*base;
+	struct bufferevent			*vpty[2];
+	struct window				*w;
+	struct environ				*env;
+	const char				*errstr;
+	char					*cause;
+	int					 opt;
+	u_int					 lines = 100000, count = 10, i;
+	u_int					 width = 0, sx = 80, sy = 24;
+	uint64_t				 start;
+
+	setlocale(LC_CTYPE, "");
+	while ((opt = getopt(argc, argv, "l:n:w:x:y:")) != -1) {
+		switch (opt) {
+		case 'l':
+			lines = strtonum(optarg, 1, INT_MAX, &errstr);
+			if (errstr != NULL)
+				errx(1, "lines %s", errstr);
+			break;
+		case 'n':
+			count = strtonum(optarg, 1, UINT_MAX, &errstr);
+			if (errstr != NULL)
+				errx(1, "count %s", errstr);
+			break;
+		case 'w':
+			width = strtonum(optarg, 0, 1000000, &errstr);
+			if (errstr != NULL)
+				errx(1, "width %s", errstr);
+			break;
+		case 'x':
+			sx = strtonum(optarg, WINDOW_MINIMUM, WINDOW_MAXIMUM,
+			    &errstr);
+			if (errstr != NULL)
+				errx(1, "width %s", errstr);
+			break;
+		case 'y':
+			sy = strtonum(optarg, WINDOW_MINIMUM, WINDOW_MAXIMUM,
+			    &errstr);
+			if (errstr != NULL)
+				errx(1, "height %s", errstr);
+			break;
+		default:
+			usage();
+		}
+	}
+	argc -= optind;
+	argv += optind;
+	if (argc == 0)
+		usage();
+
+	socket_path = xstrdup(_PATH_DEVNULL);
+	global_environ = environ_create();
+	global_options = options_create(NULL);
+	global_s_options = options_create(NULL);
+	global_w_options = options_create(NULL);
+	for (oe = options_table; oe->name != NULL; oe++) {
+		if (oe->scope & OPTIONS_TABLE_SERVER)
+			options_default(global_options, oe);
+		if (oe->scope & OPTIONS_TABLE_SESSION)
+			options_default(global_s_options, oe);
+		if (oe->scope & OPTIONS_TABLE_WINDOW)
+			options_default(global_w_options, oe);
+	}
+	options_set_number(global_s_options, "history-limit", lines);
+	options_set_number(global_w_options, "mode-keys", MODEKEY_VI);
+	base = osdep_event_init();
+	server_proc = proc_start("bench");
+
+	input_key_build();
+	utf8_update_width_cache();
+	RB_INIT(&windows);
+	RB_INIT(&all_window_panes);
+	TAILQ_INIT(&clients);
+	RB_INIT(&sessions);
+	key_bindings_init();
+	TAILQ_INIT(&message_log);
+	gettimeofday(&start_time, NULL);
+
+	env = environ_create();
+	bench_s = session_create(NULL, "bench", "/", env,
+	    options_create(global_s_options), NULL);
+	w = window_create(sx, sy, 0, 0);
+	bench_wp = window_add_pane(w, NULL, lines, 0);
+	layout_init(w, bench_wp);
+	window_set_active_pane(w, bench_wp, 0);
+	if ((bench_wl = session_attach(bench_s, w, 0, &cause)) == NULL)
+		errx(1, "%s", cause);
+	session_select(bench_s, bench_wl->idx);
+
+	bufferevent_pair_new(base, BEV_OPT_CLOSE_ON_FREE, vpty);
+	bench_wp->ictx = input_init(bench_wp, vpty[0], NULL);
+	bench_loop();
+
+	start = bench_time();
+	bench_fill(lines, width);
+	printf("history: %u lines in %.1f ms\n",
+	    bench_format("#{history_size}"), (bench_time() - start) / 1000.0);
+
+	for (i = 0; i < (u_int)argc; i++) {
+		bench_search(argv[i], 1, count);
+		bench_search(argv[i], 0, count);
+	}
+	return (0);
+}
@@ -299,6 +299,8 @@ client_main(struct event_base *base, int argc, char **argv, uint64_t flags,
 	size_t			 size, linesize = 0;
 	ssize_t			 linelen;
 	char			*line = NULL, **caps = NULL, *cause;
+	char			*exit_line;
+	u_char			 header[CONTROL_FRAME_HEADER];
 	u_int			 ncaps = 0;
 	struct args_value	*values;
 
@@ -479,9 +481,17 @@ client_main(struct event_base *base, int argc, char **argv, uint64_t flags,
 			kill(ppid, SIGHUP);
 	} else if (client_flags & CLIENT_CONTROL) {
 		if (client_exitreason != CLIENT_EXIT_NONE)
-			printf("%%exit %s\n", client_exit_message());
+			xasprintf(&exit_line, "%%exit %s", client_exit_message());
 		else
-			printf("%%exit\n");
+			exit_line = xstrdup("%exit");
+		if (client_flags & CLIENT_CONTROL_FRAMES) {
+			control_frame_header(header, CONTROL_FRAME_LINE,
+			    CONTROL_FRAME_NOPANE, 0, strlen(exit_line));
+			fwrite(header, sizeof header, 1, stdout);
+			fputs(exit_line, stdout);
+		} else
+			printf("%s\n", exit_line);
+		free(exit_line);
 		fflush(stdout);
 		if (client_flags & CLIENT_CONTROL_WAITEXIT) {
 			setvbuf(stdin, NULL, _IOLBF, 0);
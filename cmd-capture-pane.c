@@ -29,11 +29,52 @@
 
 static enum cmd_retval	cmd_capture_pane_exec(struct cmd *, struct cmdq_item *);
 
-static char	*cmd_capture_pane_append(char *, size_t *, char *, size_t);
-static char	*cmd_capture_pane_pending(struct args *, struct window_pane *,
-		     size_t *);
-static char	*cmd_capture_pane_history(struct args *, struct cmdq_item *,
-		     struct window_pane *, size_t *);
+/*
+ * Lines captured at a time. A capture of more lines is taken from a snapshot
+ * of the grid, a batch at a time from the event loop.
+ */
+#define CMD_CAPTURE_PANE_LINES 1024
+
+/* Messages waiting to be sent to a client before capturing any more. */
+#define CMD_CAPTURE_PANE_QUEUED 16
+
+struct cmd_capture_pane_data {
+	struct cmdq_item	*item;
+	struct client		*c;
+	int			 print;
+	char			*bufname;
+
+	struct grid		*gd;
+	struct screen		*s;
+	struct screen		 snapshot;
+	int			 snapshotted;
+	struct grid_cell	 lastgc;
+	u_int			 sx;
+	u_int			 next;
+	u_int			 bottom;
+	int			 flags;
+	int			 join_lines;
+
+	char			*buf;
+	size_t			 len;
+	size_t			 size;
+
+	struct event		 timer;
+};
+
+static void	cmd_capture_pane_append(struct cmd_capture_pane_data *,
+		    const char *, size_t);
+static void	cmd_capture_pane_pending(struct cmd_capture_pane_data *,
+		    struct args *, struct window_pane *);
+static int	cmd_capture_pane_history(struct cmd_capture_pane_data *,
+		    struct args *, struct cmdq_item *, struct window_pane *);
+static int	cmd_capture_pane_lines(struct cmd_capture_pane_data *);
+static void	cmd_capture_pane_release(struct cmd_capture_pane_data *);
+static void	cmd_capture_pane_snapshot(struct cmd_capture_pane_data *);
+static void	cmd_capture_pane_flush(struct cmd_capture_pane_data *);
+static int	cmd_capture_pane_finish(struct cmd_capture_pane_data *);
+static void	cmd_capture_pane_free(struct cmd_capture_pane_data *);
+static void	cmd_capture_pane_timer(int, short, void *);
 
 const struct cmd_entry cmd_capture_pane_entry = {
 	.name = "capture-pane",
@@ -62,32 +103,37 @@ const struct cmd_entry cmd_clear_history_entry = {
 	.exec = cmd_capture_pane_exec
 };
 
-static char *
-cmd_capture_pane_append(char *buf, size_t *len, char *line, size_t linelen)
+static void
+cmd_capture_pane_append(struct cmd_capture_pane_data *cd, const char *data,
+    size_t size)
 {
-	buf = xrealloc(buf, *len + linelen + 1);
-	memcpy(buf + *len, line, linelen);
-	*len += linelen;
-	return (buf);
+	if (cd->len + size + 1 > cd->size) {
+		if (cd->size == 0)
+			cd->size = 1024;
+		while (cd->len + size + 1 > cd->size)
+			cd->size *= 2;
+		cd->buf = xrealloc(cd->buf, cd->size);
+	}
+	memcpy(cd->buf + cd->len, data, size);
+	cd->len += size;
 }
 
-static char *
-cmd_capture_pane_pending(struct args *args, struct window_pane *wp,
-    size_t *len)
+static void
+cmd_capture_pane_pending(struct cmd_capture_pane_data *cd, struct args *args,
+    struct window_pane *wp)
 {
 	struct evbuffer	*pending;
-	char		*buf, *line, tmp[5];
+	char		*line, tmp[5];
 	size_t		 linelen;
 	u_int		 i;
 
 	pending = input_pending(wp->ictx);
 	if (pending == NULL)
-		return (xstrdup(""));
+		return;
 
 	line = EVBUFFER_DATA(pending);
 	linelen = EVBUFFER_LENGTH(pending);
 
-	buf = xstrdup("");
 	if (args_has(args, 'C')) {
 		for (i = 0; i < linelen; i++) {
 			if (line[i] >= ' ' && line[i] != '\\') {
@@ -95,38 +141,32 @@ cmd_capture_pane_pending(struct args *args, struct window_pane *wp,
 				tmp[1] = '\0';
 			} else
 				xsnprintf(tmp, sizeof tmp, "\\%03hho", line[i]);
-			buf = cmd_capture_pane_append(buf, len, tmp,
-			    strlen(tmp));
+			cmd_capture_pane_append(cd, tmp, strlen(tmp));
 		}
 	} else
-		buf = cmd_capture_pane_append(buf, len, line, linelen);
-	return (buf);
+		cmd_capture_pane_append(cd, line, linelen);
 }
 
-static char *
-cmd_capture_pane_history(struct args *args, struct cmdq_item *item,
-    struct window_pane *wp, size_t *len)
+static int
+cmd_capture_pane_history(struct cmd_capture_pane_data *cd, struct args *args,
+    struct cmdq_item *item, struct window_pane *wp)
 {
 	struct grid			*gd;
-	const struct grid_line		*gl;
 	struct screen			*s;
-	struct grid_cell		*gc = NULL;
 	struct window_mode_entry	*wme;
 	int				 n, join_lines, flags = 0;
-	u_int				 i, sx, top, bottom, tmp;
-	char				*cause, *buf, *line;
+	u_int				 top, bottom, tmp;
+	char				*cause;
 	const char			*Sflag, *Eflag;
-	size_t				 linelen;
 
-	sx = screen_size_x(&wp->base);
 	if (args_has(args, 'a')) {
 		gd = wp->base.saved_grid;
 		if (gd == NULL) {
 			if (!args_has(args, 'q')) {
 				cmdq_error(item, "no alternate screen");
-				return (NULL);
+				return (-1);
 			}
-			return (xstrdup(""));
+			return (0);
 		}
 		s = &wp->base;
 	} else if (args_has(args, 'M')) {
@@ -193,31 +233,198 @@ cmd_capture_pane_history(struct args *args, struct cmdq_item *item,
 	if (!join_lines && !args_has(args, 'N'))
 		flags |= GRID_STRING_TRIM_SPACES;
 
-	buf = NULL;
-	for (i = top; i <= bottom; i++) {
-		line = grid_string_cells(gd, 0, i, sx, &gc, flags, s);
-		linelen = strlen(line);
+	cd->gd = gd;
+	cd->s = s;
+	cd->sx = screen_size_x(&wp->base);
+	cd->next = top;
+	cd->bottom = bottom;
+	cd->flags = flags;
+	cd->join_lines = join_lines;
+	memcpy(&cd->lastgc, &grid_default_cell, sizeof cd->lastgc);
+	return (0);
+}
 
-		buf = cmd_capture_pane_append(buf, len, line, linelen);
+/* Capture the next batch of lines. Returns 1 if there are more to come. */
+static int
+cmd_capture_pane_lines(struct cmd_capture_pane_data *cd)
+{
+	struct grid		*gd = cd->gd;
+	const struct grid_line	*gl;
+	struct grid_cell	*gc = &cd->lastgc;
+	u_int			 i, last;
+	char			*line;
+
+	if (gd == NULL)
+		return (0);
+
+	last = cd->next + CMD_CAPTURE_PANE_LINES - 1;
+	if (last > cd->bottom)
+		last = cd->bottom;
+	for (i = cd->next; i <= last; i++) {
+		line = grid_string_cells(gd, 0, i, cd->sx, &gc, cd->flags,
+		    cd->s);
+		cmd_capture_pane_append(cd, line, strlen(line));
 
 		gl = grid_peek_line(gd, i);
-		if (!join_lines || !(gl->flags & GRID_LINE_WRAPPED))
-			buf[(*len)++] = '\n';
+		if (!cd->join_lines || !(gl->flags & GRID_LINE_WRAPPED))
+			cmd_capture_pane_append(cd, "\n", 1);
 
 		free(line);
+
+		/* Do not leave compressed history expanded. */
+		if (i % GRID_BLOCK_LINES == 0)
+			grid_pack_history(gd);
+	}
+	grid_pack_history(gd);
+
+	cd->next = last + 1;
+	if (last == cd->bottom)
+		return (0);
+	if (cd->snapshotted)
+		cmd_capture_pane_release(cd);
+	return (1);
+}
+
+/*
+ * Free the history in the snapshot that has already been captured, so any
+ * blocks read from packed or spilled history are not kept expanded.
+ */
+static void
+cmd_capture_pane_release(struct cmd_capture_pane_data *cd)
+{
+	struct grid	*gd = cd->gd;
+	u_int		 n = cd->next;
+
+	if (n > gd->hsize)
+		n = gd->hsize;
+	grid_remove_top_history(gd, n);
+	cd->next -= n;
+	cd->bottom -= n;
+}
+
+/*
+ * Take a snapshot of the grid so the rest of the capture is not affected by
+ * anything that happens to the pane in the meantime. This shares the history
+ * rather than copying it.
+ */
+static void
+cmd_capture_pane_snapshot(struct cmd_capture_pane_data *cd)
+{
+	struct grid	*gd = cd->gd;
+	struct screen	*s = &cd->snapshot;
+
+	screen_init(s, gd->sx, gd->sy, gd->hlimit);
+	grid_share_lines(s->grid, gd, gd->hsize + gd->sy);
+	if (cd->s->hyperlinks != NULL) {
+		if (s->hyperlinks != NULL)
+			hyperlinks_free(s->hyperlinks);
+		s->hyperlinks = hyperlinks_copy(cd->s->hyperlinks);
+	}
+	cd->snapshotted = 1;
+
+	cd->gd = s->grid;
+	cd->s = s;
+	cmd_capture_pane_release(cd);
+}
+
+/* Send what has been captured to the client, except a final newline. */
+static void
+cmd_capture_pane_flush(struct cmd_capture_pane_data *cd)
+{
+	size_t	n = cd->len;
+
+	if (n != 0 && cd->buf[n - 1] == '\n')
+		n--;
+	if (n == 0)
+		return;
+	file_print_buffer(cd->c, cd->buf, n);
+	memmove(cd->buf, cd->buf + n, cd->len - n);
+	cd->len -= n;
+}
+
+/* Print the capture or put it into a buffer once it is complete. */
+static int
+cmd_capture_pane_finish(struct cmd_capture_pane_data *cd)
+{
+	struct client	*c = cd->c;
+	char		*cause;
+
+	if (cd->buf == NULL)
+		cd->buf = xstrdup("");
+
+	if (cd->print) {
+		if (cd->len > 0 && cd->buf[cd->len - 1] == '\n')
+			cd->len--;
+		if (c->flags & CLIENT_CONTROL)
+			control_write(c, "%.*s", (int)cd->len, cd->buf);
+		else {
+			file_print_buffer(c, cd->buf, cd->len);
+			file_print(c, "\n");
+		}
+		return (0);
+	}
+
+	if (paste_set(cd->buf, cd->len, cd->bufname, &cause) != 0) {
+		cmdq_error(cd->item, "%s", cause);
+		free(cause);
+		return (-1);
+	}
+	cd->buf = NULL;
+	return (0);
+}
+
+static void
+cmd_capture_pane_free(struct cmd_capture_pane_data *cd)
+{
+	if (cd->snapshotted)
+		screen_free(&cd->snapshot);
+	if (cd->c != NULL)
+		server_client_unref(cd->c);
+	free(cd->bufname);
+	free(cd->buf);
+	free(cd);
+}
+
+/* Capture the next batch of lines if the client is ready for them. */
+static void
+cmd_capture_pane_timer(__unused int fd, __unused short events, void *arg)
+{
+	struct cmd_capture_pane_data	*cd = arg;
+	struct client			*c = cd->c;
+	struct timeval			 tv = { .tv_usec = 1000 };
+
+	if (cd->print) {
+		if (c->flags & CLIENT_DEAD)
+			goto out;
+		if (proc_get_peer_queued(c->peer) > CMD_CAPTURE_PANE_QUEUED) {
+			evtimer_add(&cd->timer, &tv);
+			return;
+		}
+	}
+
+	if (cmd_capture_pane_lines(cd)) {
+		if (cd->print)
+			cmd_capture_pane_flush(cd);
+		timerclear(&tv);
+		evtimer_add(&cd->timer, &tv);
+		return;
 	}
-	return (buf);
+	cmd_capture_pane_finish(cd);
+
+out:
+	cmdq_continue(cd->item);
+	cmd_capture_pane_free(cd);
 }
 
 static enum cmd_retval
 cmd_capture_pane_exec(struct cmd *self, struct cmdq_item *item)
 {
-	struct args		*args = cmd_get_args(self);
-	struct client		*c = cmdq_get_client(item);
-	struct window_pane	*wp = cmdq_get_target(item)->wp;
-	char			*buf, *cause;
-	const char		*bufname;
-	size_t			 len;
+	struct args			*args = cmd_get_args(self);
+	struct client			*c = cmdq_get_client(item);
+	struct window_pane		*wp = cmdq_get_target(item)->wp;
+	struct cmd_capture_pane_data	*cd;
+	struct timeval			 tv = { 0 };
+	int				 more = 0, error;
 
 	if (cmd_get_entry(self) == &cmd_clear_history_entry) {
 		window_pane_reset_mode_all(wp);
@@ -227,41 +434,52 @@ cmd_capture_pane_exec(struct cmd *self, struct cmdq_item *item)
 		return (CMD_RETURN_NORMAL);
 	}
 
-	len = 0;
+	cd = xcalloc(1, sizeof *cd);
+	cd->item = item;
+	cd->print = args_has(args, 'p');
+	if (args_has(args, 'b'))
+		cd->bufname = xstrdup(args_get(args, 'b'));
+	if (cd->print && c != NULL) {
+		cd->c = c;
+		c->references++;
+	}
+
 	if (args_has(args, 'P'))
-		buf = cmd_capture_pane_pending(args, wp, &len);
-	else
-		buf = cmd_capture_pane_history(args, item, wp, &len);
-	if (buf == NULL)
+		cmd_capture_pane_pending(cd, args, wp);
+	else if (cmd_capture_pane_history(cd, args, item, wp) != 0) {
+		cmd_capture_pane_free(cd);
+		return (CMD_RETURN_ERROR);
+	}
+	if (cd->print &&
+	    (c == NULL || (~c->flags & CLIENT_CONTROL)) &&
+	    !file_can_print(c)) {
+		cmdq_error(item, "can't write to client");
+		cmd_capture_pane_free(cd);
 		return (CMD_RETURN_ERROR);
+	}
 
-	if (args_has(args, 'p')) {
-		if (len > 0 && buf[len - 1] == '\n')
-			len--;
-		if (c->flags & CLIENT_CONTROL)
-			control_write(c, "%.*s", (int)len, buf);
-		else {
-			if (!file_can_print(c)) {
-				cmdq_error(item, "can't write to client");
-				free(buf);
-				return (CMD_RETURN_ERROR);
-			}
-			file_print_buffer(c, buf, len);
-			file_print(c, "\n");
+	if (!args_has(args, 'P')) {
+		more = cmd_capture_pane_lines(cd);
+
+		/* Control clients need the output all at once. */
+		if (cd->print && (c->flags & CLIENT_CONTROL)) {
+			while (more)
+				more = cmd_capture_pane_lines(cd);
 		}
-		free(buf);
-	} else {
-		bufname = NULL;
-		if (args_has(args, 'b'))
-			bufname = args_get(args, 'b');
+	}
 
-		if (paste_set(buf, len, bufname, &cause) != 0) {
-			cmdq_error(item, "%s", cause);
-			free(cause);
-			free(buf);
+	if (!more) {
+		error = cmd_capture_pane_finish(cd);
+		cmd_capture_pane_free(cd);
+		if (error != 0)
 			return (CMD_RETURN_ERROR);
-		}
+		return (CMD_RETURN_NORMAL);
 	}
 
-	return (CMD_RETURN_NORMAL);
+	cmd_capture_pane_snapshot(cd);
+	if (cd->print)
+		cmd_capture_pane_flush(cd);
+	evtimer_set(&cd->timer, cmd_capture_pane_timer, cd);
+	evtimer_add(&cd->timer, &tv);
+	return (CMD_RETURN_WAIT);
 }
@@ -19,6 +19,8 @@
 
 #include <sys/types.h>
 
+#include <netinet/in.h>
+
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
@@ -384,6 +386,42 @@ control_pause_pane(struct client *c, struct window_pane *wp)
 	}
 }
 
+/* Build a frame header. */
+void
+control_frame_header(u_char *header, u_char type, u_int pane, uint64_t age,
+    size_t size)
+{
+	uint32_t	n32;
+	uint64_t	n64;
+
+	header[0] = type;
+	n32 = htonl(pane);
+	memcpy(header + 1, &n32, sizeof n32);
+	n64 = htonll(age);
+	memcpy(header + 5, &n64, sizeof n64);
+	n32 = htonl(size);
+	memcpy(header + 13, &n32, sizeof n32);
+}
+
+/* Write a line, either newline terminated or as a frame. */
+static void
+control_write_line(struct client *c, const char *line)
+{
+	struct control_state	*cs = c->control_state;
+	u_char			 header[CONTROL_FRAME_HEADER];
+	size_t			 size = strlen(line);
+
+	if (c->flags & CLIENT_CONTROL_FRAMES) {
+		control_frame_header(header, CONTROL_FRAME_LINE,
+		    CONTROL_FRAME_NOPANE, 0, size);
+		bufferevent_write(cs->write_event, header, sizeof header);
+		bufferevent_write(cs->write_event, line, size);
+	} else {
+		bufferevent_write(cs->write_event, line, size);
+		bufferevent_write(cs->write_event, "\n", 1);
+	}
+}
+
 /* Write a line. */
 static void printflike(2, 0)
 control_vwrite(struct client *c, const char *fmt, va_list ap)
@@ -394,8 +432,7 @@ control_vwrite(struct client *c, const char *fmt, va_list ap)
 	xvasprintf(&s, fmt, ap);
 	log_debug("%s: %s: writing line: %s", __func__, c->name, s);
 
-	bufferevent_write(cs->write_event, s, strlen(s));
-	bufferevent_write(cs->write_event, "\n", 1);
+	control_write_line(c, s);
 
 	bufferevent_enable(cs->write_event, EV_WRITE);
 	free(s);
@@ -598,26 +635,55 @@ control_flush_all_blocks(struct client *c)
 		log_debug("%s: %s: flushing line: %s", __func__, c->name,
 		    cb->line);
 
-		bufferevent_write(cs->write_event, cb->line, strlen(cb->line));
-		bufferevent_write(cs->write_event, "\n", 1);
+		control_write_line(c, cb->line);
 		control_free_block(cs, cb);
 	}
 }
 
+/*
+ * Escape data into buffer. Bytes less than space and backslash are written as
+ * octal; everything else is copied as is, a run at a time.
+ */
+void
+control_escape_data(struct evbuffer *message, const u_char *data, size_t size)
+{
+	const u_char	*end = data + size, *start;
+	char		 tmp[4];
+
+	evbuffer_expand(message, size);
+	while (data != end) {
+		start = data;
+		while (data != end && *data >= ' ' && *data != '\\')
+			data++;
+		if (data != start)
+			evbuffer_add(message, start, data - start);
+		if (data == end)
+			break;
+
+		tmp[0] = '\\';
+		tmp[1] = '0' + ((*data >> 6) & 7);
+		tmp[2] = '0' + ((*data >> 3) & 7);
+		tmp[3] = '0' + (*data & 7);
+		evbuffer_add(message, tmp, sizeof tmp);
+		data++;
+	}
+}
+
 /* Append data to buffer. */
 static struct evbuffer *
 control_append_data(struct client *c, struct control_pane *cp, uint64_t age,
     struct evbuffer *message, struct window_pane *wp, size_t size)
 {
-	u_char	*new_data;
+	u_char	*new_data, header[CONTROL_FRAME_HEADER];
 	size_t	 new_size;
-	u_int	 i;
 
 	if (message == NULL) {
 		message = evbuffer_new();
 		if (message == NULL)
 			fatalx("out of memory");
-		if (c->flags & CLIENT_CONTROL_PAUSEAFTER) {
+		if (c->flags & CLIENT_CONTROL_FRAMES) {
+			/* Nothing - each frame has its own header. */
+		} else if (c->flags & CLIENT_CONTROL_PAUSEAFTER) {
 			evbuffer_add_printf(message,
 			    "%%extended-output %%%u %llu : ", wp->id,
 			    (unsigned long long)age);
@@ -628,12 +694,13 @@ control_append_data(struct client *c, struct control_pane *cp, uint64_t age,
 	new_data = window_pane_get_new_data(wp, &cp->offset, &new_size);
 	if (new_size < size)
 		fatalx("not enough data: %zu < %zu", new_size, size);
-	for (i = 0; i < size; i++) {
-		if (new_data[i] < ' ' || new_data[i] == '\\')
-			evbuffer_add_printf(message, "\\%03o", new_data[i]);
-		else
-			evbuffer_add_printf(message, "%c", new_data[i]);
-	}
+	if (c->flags & CLIENT_CONTROL_FRAMES) {
+		control_frame_header(header, CONTROL_FRAME_OUTPUT, wp->id, age,
+		    size);
+		evbuffer_add(message, header, sizeof header);
+		evbuffer_add(message, new_data, size);
+	} else
+		control_escape_data(message, new_data, size);
 	window_pane_update_used_data(wp, &cp->offset, size);
 	return (message);
 }
@@ -644,10 +711,14 @@ control_write_data(struct client *c, struct evbuffer *message)
 {
 	struct control_state	*cs = c->control_state;
 
-	log_debug("%s: %s: %.*s", __func__, c->name,
-	    (int)EVBUFFER_LENGTH(message), EVBUFFER_DATA(message));
-
-	evbuffer_add(message, "\n", 1);
+	if (c->flags & CLIENT_CONTROL_FRAMES) {
+		log_debug("%s: %s: %zu bytes of frames", __func__, c->name,
+		    EVBUFFER_LENGTH(message));
+	} else {
+		log_debug("%s: %s: %.*s", __func__, c->name,
+		    (int)EVBUFFER_LENGTH(message), EVBUFFER_DATA(message));
+		evbuffer_add(message, "\n", 1);
+	}
 	bufferevent_write_buffer(cs->write_event, message);
 	evbuffer_free(message);
 }
@@ -736,7 +807,9 @@ control_write_callback(__unused struct bufferevent *bufev, void *data)
 		log_debug("%s: %s: %zu bytes available, %u panes", __func__,
 		    c->name, space, cs->pending_count);
 
-		limit = (space / cs->pending_count / 3); /* 3 bytes for \xxx */
+		limit = space / cs->pending_count;
+		if (~c->flags & CLIENT_CONTROL_FRAMES)
+			limit /= 3; /* 3 bytes for \xxx */
 		if (limit < CONTROL_WRITE_MINIMUM)
 			limit = CONTROL_WRITE_MINIMUM;
 
@@ -40,11 +40,12 @@
  */
 
 struct format_expand_state;
+struct format_step;
 
 static char	*format_job_get(struct format_expand_state *, const char *);
 static char	*format_expand1(struct format_expand_state *, const char *);
-static int	 format_replace(struct format_expand_state *, const char *,
-		     size_t, char **, size_t *, size_t *);
+static int	 format_replace(struct format_expand_state *,
+		     struct format_step *, char **, size_t *, size_t *);
 static void	 format_defaults_session(struct format_tree *,
 		     struct session *);
 static void	 format_defaults_client(struct format_tree *, struct client *);
@@ -184,6 +185,67 @@ struct format_modifier {
 	int	  argc;
 };
 
+/* Limit on number of parsed formats kept. */
+#define FORMAT_PROGRAM_LIMIT 256
+
+/* Step in a parsed format. */
+enum format_step_type {
+	FORMAT_STEP_TEXT,
+	FORMAT_STEP_JOB,
+	FORMAT_STEP_REPLACE
+};
+struct format_step {
+	enum format_step_type	 type;
+
+	size_t			 off;
+	size_t			 n;
+
+	char			*s;
+	int			 alias;
+
+	int			 cached;
+	struct format_modifier	*list;
+	u_int			 count;
+	size_t			 skip;
+};
+
+/*
+ * Parsed format. Each format string is split into steps once and the result
+ * kept in a tree, with the least recently used dropped when there are too
+ * many. Formats being expanded are referenced and are never dropped.
+ */
+struct format_program {
+	char				*fmt;
+	char				*text;
+
+	struct format_step		*steps;
+	u_int				 nsteps;
+
+	u_int				 references;
+
+	RB_ENTRY(format_program)	 entry;
+	TAILQ_ENTRY(format_program)	 lru_entry;
+};
+TAILQ_HEAD(format_program_list, format_program);
+static struct format_program_list format_program_lru =
+    TAILQ_HEAD_INITIALIZER(format_program_lru);
+static u_int format_program_count;
+
+/* Parsed format tree. */
+static int format_program_cmp(struct format_program *,
+    struct format_program *);
+static RB_HEAD(format_program_tree, format_program) format_programs =
+    RB_INITIALIZER();
+RB_GENERATE_STATIC(format_program_tree, format_program, entry,
+    format_program_cmp);
+
+/* Parsed format tree comparison function. */
+static int
+format_program_cmp(struct format_program *fp1, struct format_program *fp2)
+{
+	return (strcmp(fp1->fmt, fp2->fmt));
+}
+
 /* Format entry tree comparison function. */
 static int
 format_entry_cmp(struct format_entry *fe1, struct format_entry *fe2)
@@ -933,11 +995,14 @@ format_cb_history_bytes(struct format_tree *ft)
 	gd = wp->base.grid;
 
 	for (i = 0; i < gd->hsize + gd->sy; i++) {
+		if (grid_line_packed(gd, i))
+			continue;
 		gl = grid_get_line(gd, i);
+		size += sizeof *gl;
 		size += gl->cellsize * sizeof *gl->celldata;
 		size += gl->extdsize * sizeof *gl->extddata;
 	}
-	size += (gd->hsize + gd->sy) * sizeof *gl;
+	size += grid_packed_size(gd);
 
 	xasprintf(&value, "%zu", size);
 	return (value);
@@ -959,6 +1024,8 @@ format_cb_history_all_bytes(struct format_tree *ft)
 
 	lines = gd->hsize + gd->sy;
 	for (i = 0; i < lines; i++) {
+		if (grid_line_packed(gd, i))
+			continue;
 		gl = grid_get_line(gd, i);
 		cells += gl->cellsize;
 		extended_cells += gl->extdsize;
@@ -1542,6 +1609,15 @@ format_cb_client_session(struct format_tree *ft)
 	return (NULL);
 }
 
+/* Callback for client_sgr_saved. */
+static void *
+format_cb_client_sgr_saved(struct format_tree *ft)
+{
+	if (ft->c != NULL)
+		return (format_printf("%zu", ft->c->sgr_saved));
+	return (NULL);
+}
+
 /* Callback for client_termfeatures. */
 static void *
 format_cb_client_termfeatures(struct format_tree *ft)
@@ -3018,7 +3094,9 @@ format_cb_user(__unused struct format_tree *ft)
 /* Format table type. */
 enum format_table_type {
 	FORMAT_TABLE_STRING,
-	FORMAT_TABLE_TIME
+	FORMAT_TABLE_TIME,
+	FORMAT_TABLE_PANE_MEMO,
+	FORMAT_TABLE_WINDOW_MEMO
 };
 
 /* Format table entry. */
@@ -3112,6 +3190,9 @@ static const struct format_table_entry format_table[] = {
 	{ "client_session", FORMAT_TABLE_STRING,
 	  format_cb_client_session
 	},
+	{ "client_sgr_saved", FORMAT_TABLE_STRING,
+	  format_cb_client_sgr_saved
+	},
 	{ "client_termfeatures", FORMAT_TABLE_STRING,
 	  format_cb_client_termfeatures
 	},
@@ -3169,10 +3250,10 @@ static const struct format_table_entry format_table[] = {
 	{ "cursor_y", FORMAT_TABLE_STRING,
 	  format_cb_cursor_y
 	},
-	{ "history_all_bytes", FORMAT_TABLE_STRING,
+	{ "history_all_bytes", FORMAT_TABLE_PANE_MEMO,
 	  format_cb_history_all_bytes
 	},
-	{ "history_bytes", FORMAT_TABLE_STRING,
+	{ "history_bytes", FORMAT_TABLE_PANE_MEMO,
 	  format_cb_history_bytes
 	},
 	{ "history_limit", FORMAT_TABLE_STRING,
@@ -3271,10 +3352,10 @@ static const struct format_table_entry format_table[] = {
 	{ "pane_bottom", FORMAT_TABLE_STRING,
 	  format_cb_pane_bottom
 	},
-	{ "pane_current_command", FORMAT_TABLE_STRING,
+	{ "pane_current_command", FORMAT_TABLE_PANE_MEMO,
 	  format_cb_current_command
 	},
-	{ "pane_current_path", FORMAT_TABLE_STRING,
+	{ "pane_current_path", FORMAT_TABLE_PANE_MEMO,
 	  format_cb_current_path
 	},
 	{ "pane_dead", FORMAT_TABLE_STRING,
@@ -3538,7 +3619,7 @@ static const struct format_table_entry format_table[] = {
 	{ "window_last_flag", FORMAT_TABLE_STRING,
 	  format_cb_window_last_flag
 	},
-	{ "window_layout", FORMAT_TABLE_STRING,
+	{ "window_layout", FORMAT_TABLE_WINDOW_MEMO,
 	  format_cb_window_layout
 	},
 	{ "window_linked", FORMAT_TABLE_STRING,
@@ -3577,7 +3658,7 @@ static const struct format_table_entry format_table[] = {
 	{ "window_start_flag", FORMAT_TABLE_STRING,
 	  format_cb_window_start_flag
 	},
-	{ "window_visible_layout", FORMAT_TABLE_STRING,
+	{ "window_visible_layout", FORMAT_TABLE_WINDOW_MEMO,
 	  format_cb_window_visible_layout
 	},
 	{ "window_width", FORMAT_TABLE_STRING,
@@ -3609,6 +3690,119 @@ format_table_get(const char *key)
 	    sizeof *format_table, format_table_compare));
 }
 
+/* Is a format table key also the name of an option? */
+static int
+format_table_is_option(struct format_table_entry *fte)
+{
+	static int				 checked;
+	static u_char				 is_option[nitems(format_table)];
+	const struct options_table_entry	*oe;
+	struct format_table_entry		*found;
+
+	if (!checked) {
+		for (oe = options_table; oe->name != NULL; oe++) {
+			found = format_table_get(oe->name);
+			if (found != NULL)
+				is_option[found - format_table] = 1;
+		}
+		checked = 1;
+	}
+	return (is_option[fte - format_table]);
+}
+
+/*
+ * Values of some expensive callbacks are kept while clients are redrawn, so
+ * that each is worked out once for each pane or window however many clients
+ * and formats use it. Nothing can change them during the redraw.
+ */
+struct format_memo {
+	const struct format_table_entry	*fte;
+	u_int				 id;
+	char				*value;
+
+	RB_ENTRY(format_memo)		 entry;
+};
+static int format_memo_cmp(struct format_memo *, struct format_memo *);
+static RB_HEAD(format_memo_tree, format_memo) format_memos = RB_INITIALIZER();
+RB_GENERATE_STATIC(format_memo_tree, format_memo, entry, format_memo_cmp);
+static int	format_memo_active;
+static u_int	format_memo_hits;
+static u_int	format_memo_misses;
+
+/* Format memo tree comparison function. */
+static int
+format_memo_cmp(struct format_memo *fm1, struct format_memo *fm2)
+{
+	if (fm1->fte < fm2->fte)
+		return (-1);
+	if (fm1->fte > fm2->fte)
+		return (1);
+	if (fm1->id < fm2->id)
+		return (-1);
+	if (fm1->id > fm2->id)
+		return (1);
+	return (0);
+}
+
+/* Start keeping callback values. */
+void
+format_memo_start(void)
+{
+	format_memo_active = 1;
+}
+
+/* Stop keeping callback values and discard them. */
+void
+format_memo_end(void)
+{
+	struct format_memo	*fm, *fm1;
+
+	RB_FOREACH_SAFE(fm, format_memo_tree, &format_memos, fm1) {
+		RB_REMOVE(format_memo_tree, &format_memos, fm);
+		free(fm->value);
+		free(fm);
+	}
+	format_memo_active = 0;
+
+	if (format_memo_hits != 0 || format_memo_misses != 0) {
+		log_debug("%s: %u hits, %u misses", __func__, format_memo_hits,
+		    format_memo_misses);
+	}
+	format_memo_hits = format_memo_misses = 0;
+}
+
+/* Get a callback value, using the kept value if there is one. */
+static char *
+format_memo_get(struct format_tree *ft, const struct format_table_entry *fte)
+{
+	struct format_memo	 find, *fm;
+
+	if (!format_memo_active)
+		return (fte->cb(ft));
+	if (fte->type == FORMAT_TABLE_PANE_MEMO && ft->wp != NULL)
+		find.id = ft->wp->id;
+	else if (fte->type == FORMAT_TABLE_WINDOW_MEMO && ft->w != NULL)
+		find.id = ft->w->id;
+	else
+		return (fte->cb(ft));
+	find.fte = fte;
+
+	fm = RB_FIND(format_memo_tree, &format_memos, &find);
+	if (fm != NULL)
+		format_memo_hits++;
+	else {
+		fm = xcalloc(1, sizeof *fm);
+		fm->fte = fte;
+		fm->id = find.id;
+		fm->value = fte->cb(ft);
+		RB_INSERT(format_memo_tree, &format_memos, fm);
+		format_memo_misses++;
+	}
+	if (fm->value == NULL)
+		return (NULL);
+	return (xstrdup(fm->value));
+}
+
 /* Merge one format tree into another. */
 void
 format_merge(struct format_tree *ft, struct format_tree *from)
@@ -3900,32 +4094,48 @@ format_find(struct format_tree *ft, const char *key, int modifiers,
 	void				*value;
 	struct format_entry		*fe, fe_find;
 	struct environ_entry		*envent;
-	struct options_entry		*o;
+	struct options_entry		*o = NULL;
 	int				 idx;
-	char				*found = NULL, *saved, s[512];
-	const char			*errstr;
+	char				*found = NULL, *saved, *copy = NULL, s[512];
+	const char			*errstr, *name = NULL;
 	time_t				 t = 0;
 	struct tm			 tm;
 
-	o = options_parse_get(global_options, key, &idx, 0);
-	if (o == NULL && ft->wp != NULL)
-		o = options_parse_get(ft->wp->options, key, &idx, 0);
-	if (o == NULL && ft->w != NULL)
-		o = options_parse_get(ft->w->options, key, &idx, 0);
-	if (o == NULL)
-		o = options_parse_get(global_w_options, key, &idx, 0);
-	if (o == NULL && ft->s != NULL)
-		o = options_parse_get(ft->s->options, key, &idx, 0);
-	if (o == NULL)
-		o = options_parse_get(global_s_options, key, &idx, 0);
+	/*
+	 * Options come first, but most keys are in the table and are not also
+	 * options, so do not look for those. Only copy the key if it has an
+	 * index to remove.
+	 */
+	fte = format_table_get(key);
+	if (fte == NULL || format_table_is_option(fte)) {
+		if (strchr(key, '[') != NULL)
+			name = copy = options_parse(key, &idx);
+		else {
+			name = key;
+			idx = -1;
+		}
+	}
+	if (name != NULL) {
+		o = options_get(global_options, name);
+		if (o == NULL && ft->wp != NULL)
+			o = options_get(ft->wp->options, name);
+		if (o == NULL && ft->w != NULL)
+			o = options_get(ft->w->options, name);
+		if (o == NULL)
+			o = options_get(global_w_options, name);
+		if (o == NULL && ft->s != NULL)
+			o = options_get(ft->s->options, name);
+		if (o == NULL)
+			o = options_get(global_s_options, name);
+		free(copy);
+	}
 	if (o != NULL) {
 		found = options_to_string(o, idx, 1);
 		goto found;
 	}
 
-	fte = format_table_get(key);
 	if (fte != NULL) {
-		value = fte->cb(ft);
+		value = format_memo_get(ft, fte);
 		if (fte->type == FORMAT_TABLE_TIME && value != NULL)
 			t = ((struct timeval *)value)->tv_sec;
 		else
@@ -4450,7 +4660,7 @@ format_loop_sessions(struct format_expand_state *es, const char *fmt)
 	struct format_tree		 *nft;
 	struct format_expand_state	  next;
 	char				 *all, *active, *use, *expanded, *value;
-	size_t				  valuelen;
+	size_t				  valuelen, expandedlen;
 	struct session			 *s;
 	int				  i, n, last = 0;
 	static struct session		**l = NULL;
@@ -4493,10 +4703,10 @@ format_loop_sessions(struct format_expand_state *es, const char *fmt)
 		expanded = format_expand1(&next, use);
 		format_free(next.ft);
 
-		valuelen += strlen(expanded);
-		value = xrealloc(value, valuelen);
-
-		strlcat(value, expanded, valuelen);
+		expandedlen = strlen(expanded);
+		value = xrealloc(value, valuelen + expandedlen);
+		memcpy(value + valuelen - 1, expanded, expandedlen + 1);
+		valuelen += expandedlen;
 		free(expanded);
 	}
 
@@ -4571,7 +4781,7 @@ format_loop_windows(struct format_expand_state *es, const char *fmt)
 	struct format_tree		 *nft;
 	struct format_expand_state	  next;
 	char				 *all, *active, *use, *expanded, *value;
-	size_t				  valuelen;
+	size_t				  valuelen, expandedlen;
 	struct winlink			 *wl;
 	struct window			 *w;
 	int				  i, n, last = 0;
@@ -4631,10 +4841,10 @@ format_loop_windows(struct format_expand_state *es, const char *fmt)
 		expanded = format_expand1(&next, use);
 		format_free(nft);
 
-		valuelen += strlen(expanded);
-		value = xrealloc(value, valuelen);
-
-		strlcat(value, expanded, valuelen);
+		expandedlen = strlen(expanded);
+		value = xrealloc(value, valuelen + expandedlen);
+		memcpy(value + valuelen - 1, expanded, expandedlen + 1);
+		valuelen += expandedlen;
 		free(expanded);
 	}
 
@@ -4671,7 +4881,7 @@ format_loop_panes(struct format_expand_state *es, const char *fmt)
 	struct format_tree		*nft;
 	struct format_expand_state	 next;
 	char				*all, *active, *use, *expanded, *value;
-	size_t				 valuelen;
+	size_t				 valuelen, expandedlen;
 	struct window_pane		*wp;
 	int				  i, n, last = 0;
 	static struct window_pane	**l = NULL;
@@ -4718,10 +4928,10 @@ format_loop_panes(struct format_expand_state *es, const char *fmt)
 		expanded = format_expand1(&next, use);
 		format_free(nft);
 
-		valuelen += strlen(expanded);
-		value = xrealloc(value, valuelen);
-
-		strlcat(value, expanded, valuelen);
+		expandedlen = strlen(expanded);
+		value = xrealloc(value, valuelen + expandedlen);
+		memcpy(value + valuelen - 1, expanded, expandedlen + 1);
+		valuelen += expandedlen;
 		free(expanded);
 	}
 
@@ -4775,7 +4985,7 @@ format_loop_clients(struct format_expand_state *es, const char *fmt)
 	struct format_tree		 *nft;
 	struct format_expand_state	  next;
 	char				 *expanded, *value;
-	size_t				  valuelen;
+	size_t				  valuelen, expandedlen;
 	int				  i, n, last = 0;
 	static struct client		**l = NULL;
 	static int			  lsz = 0;
@@ -4817,10 +5027,10 @@ format_loop_clients(struct format_expand_state *es, const char *fmt)
 		expanded = format_expand1(&next, fmt);
 		format_free(nft);
 
-		valuelen += strlen(expanded);
-		value = xrealloc(value, valuelen);
-
-		strlcat(value, expanded, valuelen);
+		expandedlen = strlen(expanded);
+		value = xrealloc(value, valuelen + expandedlen);
+		memcpy(value + valuelen - 1, expanded, expandedlen + 1);
+		valuelen += expandedlen;
 		free(expanded);
 	}
 
@@ -4971,16 +5181,16 @@ fail:
 
 /* Replace a key. */
 static int
-format_replace(struct format_expand_state *es, const char *key, size_t keylen,
+format_replace(struct format_expand_state *es, struct format_step *step,
     char **buf, size_t *len, size_t *off)
 {
 	struct format_loop_sort_criteria *sc = &format_loop_sort_criteria;
 	struct format_tree		 *ft = es->ft;
 	struct window_pane		 *wp = ft->wp;
-	const char			 *errstr, *copy, *cp, *cp2;
+	const char			 *errstr, *copy, *copy0, *cp, *cp2;
 	const char			 *marker = NULL;
 	char				 *time_format = NULL;
-	char				 *copy0, *condition, *found, *new;
+	char				 *condition, *found, *new;
 	char				 *value, *left, *right;
 	size_t				  valuelen;
 	int				  modifiers = 0, limit = 0, width = 0;
@@ -4991,11 +5201,24 @@ format_replace(struct format_expand_state *es, const char *key, size_t keylen,
 	u_int				  i, count, nsub = 0, nrep;
 	struct format_expand_state	  next;
 
-	/* Make a copy of the key. */
-	copy = copy0 = xstrndup(key, keylen);
-
-	/* Process modifier list. */
-	list = format_build_modifiers(es, &copy, &count);
+	/*
+	 * Process modifier list. If none of the arguments can change when
+	 * expanded, keep the list with the step and use it next time.
+	 */
+	copy = copy0 = step->s;
+	if (step->cached) {
+		list = step->list;
+		count = step->count;
+		copy += step->skip;
+	} else {
+		list = format_build_modifiers(es, &copy, &count);
+		if (strcspn(copy0, "#%") >= (size_t)(copy - copy0)) {
+			step->list = list;
+			step->count = count;
+			step->skip = copy - copy0;
+			step->cached = 1;
+		}
+	}
 	for (i = 0; i < count; i++) {
 		fm = &list[i];
 		if (format_logging(ft)) {
@@ -5512,8 +5735,8 @@ done:
 	free(value);
 
 	free(sub);
-	format_free_modifiers(list, count);
-	free(copy0);
+	if (!step->cached)
+		format_free_modifiers(list, count);
 	free(time_format);
 	return (0);
 
@@ -5521,67 +5744,96 @@ fail:
 	format_log(es, "failed %s", copy0);
 
 	free(sub);
-	format_free_modifiers(list, count);
-	free(copy0);
+	if (!step->cached)
+		format_free_modifiers(list, count);
 	free(time_format);
 	return (-1);
 }
 
-/* Expand keys in a template. */
-static char *
-format_expand1(struct format_expand_state *es, const char *fmt)
+/* Add literal text to a parsed format. */
+static void
+format_program_add_text(struct format_program *fp, size_t *textlen,
+    const char *text, size_t n)
 {
-	struct format_tree	*ft = es->ft;
-	char			*buf, *out, *name;
-	const char		*ptr, *s, *style_end = NULL;
-	size_t			 off, len, n, outlen;
-	int			 ch, brackets;
-	char			 expanded[8192];
+	struct format_step	*step = NULL;
+	size_t			 off = 0;
 
-	if (fmt == NULL || *fmt == '\0')
-		return (xstrdup(""));
+	if (fp->nsteps != 0) {
+		step = &fp->steps[fp->nsteps - 1];
+		off = step->off + step->n;
+		if (step->type != FORMAT_STEP_TEXT)
+			step = NULL;
+	}
+	if (step == NULL) {
+		fp->steps = xreallocarray(fp->steps, fp->nsteps + 1,
+		    sizeof *fp->steps);
+		step = &fp->steps[fp->nsteps++];
+		memset(step, 0, sizeof *step);
+		step->type = FORMAT_STEP_TEXT;
+		step->off = off;
+	}
 
-	if (es->loop == FORMAT_LOOP_LIMIT) {
-		format_log(es, "reached loop limit (%u)", FORMAT_LOOP_LIMIT);
-		return (xstrdup(""));
+	while (*textlen - step->off - step->n < n + 1) {
+		fp->text = xreallocarray(fp->text, 2, *textlen);
+		*textlen *= 2;
 	}
-	es->loop++;
+	memcpy(fp->text + step->off + step->n, text, n);
+	step->n += n;
+}
 
-	format_log(es, "expanding format: %s", fmt);
+/* Add a job or replacement to a parsed format. */
+static void
+format_program_add_step(struct format_program *fp, enum format_step_type type,
+    char *s, int alias)
+{
+	struct format_step	*step;
+	size_t			 off = 0;
 
-	if ((es->flags & FORMAT_EXPAND_TIME) && strchr(fmt, '%') != NULL) {
-		if (es->time == 0) {
-			es->time = time(NULL);
-			localtime_r(&es->time, &es->tm);
-		}
-		if (format_strftime(expanded, sizeof expanded, fmt,
-		    &es->tm) == 0) {
-			format_log(es, "format is too long");
-			return (xstrdup(""));
-		}
-		if (format_logging(ft) && strcmp(expanded, fmt) != 0)
-			format_log(es, "after time expanded: %s", expanded);
-		fmt = expanded;
+	if (fp->nsteps != 0) {
+		step = &fp->steps[fp->nsteps - 1];
+		off = step->off + step->n;
 	}
 
-	len = 64;
-	buf = xmalloc(len);
-	off = 0;
+	fp->steps = xreallocarray(fp->steps, fp->nsteps + 1,
+	    sizeof *fp->steps);
+	step = &fp->steps[fp->nsteps++];
+	memset(step, 0, sizeof *step);
+	step->type = type;
+	step->off = off;
+	step->s = s;
+	step->alias = alias;
+}
+
+/* Split a format into steps. */
+static struct format_program *
+format_program_parse(const char *fmt)
+{
+	struct format_program	*fp;
+	const char		*ptr, *s, *style_end = NULL;
+	size_t			 n, textlen = 64;
+	int			 ch, brackets;
+	char			 c;
+
+	fp = xcalloc(1, sizeof *fp);
+	fp->fmt = xstrdup(fmt);
+	fp->text = xmalloc(textlen);
 
+	fmt = fp->fmt;
 	while (*fmt != '\0') {
 		if (*fmt != '#') {
-			while (len - off < 2) {
-				buf = xreallocarray(buf, 2, len);
-				len *= 2;
-			}
-			buf[off++] = *fmt++;
+			for (n = 1; fmt[n] != '\0' && fmt[n] != '#'; n++)
+				/* nothing */;
+			format_program_add_text(fp, &textlen, fmt, n);
+			fmt += n;
 			continue;
 		}
-		if (*fmt++ == '\0')
-			break;
+		fmt++;
 
 		ch = (u_char)*fmt++;
 		switch (ch) {
+		case '\0':
+			format_program_add_text(fp, &textlen, "#", 1);
+			break;
 		case '(':
 			brackets = 1;
 			for (ptr = fmt; *ptr != '\0'; ptr++) {
@@ -5593,30 +5845,8 @@ format_expand1(struct format_expand_state *es, const char *fmt)
 			if (*ptr != ')' || brackets != 0)
 				break;
 			n = ptr - fmt;
-
-			name = xstrndup(fmt, n);
-			format_log(es, "found #(): %s", name);
-
-			if ((ft->flags & FORMAT_NOJOBS) ||
-			    (es->flags & FORMAT_EXPAND_NOJOBS)) {
-				out = xstrdup("");
-				format_log(es, "#() is disabled");
-			} else {
-				out = format_job_get(es, name);
-				format_log(es, "#() result: %s", out);
-			}
-			free(name);
-
-			outlen = strlen(out);
-			while (len - off < outlen + 1) {
-				buf = xreallocarray(buf, 2, len);
-				len *= 2;
-			}
-			memcpy(buf + off, out, outlen);
-			off += outlen;
-
-			free(out);
-
+			format_program_add_step(fp, FORMAT_STEP_JOB,
+			    xstrndup(fmt, n), 0);
 			fmt += n + 1;
 			continue;
 		case '{':
@@ -5624,10 +5854,8 @@ format_expand1(struct format_expand_state *es, const char *fmt)
 			if (ptr == NULL)
 				break;
 			n = ptr - fmt;
-
-			format_log(es, "found #{}: %.*s", (int)n, fmt);
-			if (format_replace(es, fmt, n, &buf, &len, &off) != 0)
-				break;
+			format_program_add_step(fp, FORMAT_STEP_REPLACE,
+			    xstrndup(fmt, n), 0);
 			fmt += n + 1;
 			continue;
 		case '[':
@@ -5644,25 +5872,16 @@ format_expand1(struct format_expand_state *es, const char *fmt)
 			}
 			if (*ptr == '[') {
 				style_end = format_skip(fmt - 2, "]");
-				format_log(es, "found #*%zu[", n);
-				while (len - off < n + 2) {
-					buf = xreallocarray(buf, 2, len);
-					len *= 2;
-				}
-				memcpy(buf + off, fmt - 2, n + 1);
-				off += n + 1;
+				format_program_add_text(fp, &textlen, fmt - 2,
+				    n + 1);
 				fmt = ptr + 1;
 				continue;
 			}
 			/* FALLTHROUGH */
 		case '}':
 		case ',':
-			format_log(es, "found #%c", ch);
-			while (len - off < 2) {
-				buf = xreallocarray(buf, 2, len);
-				len *= 2;
-			}
-			buf[off++] = ch;
+			c = ch;
+			format_program_add_text(fp, &textlen, &c, 1);
 			continue;
 		default:
 			s = NULL;
@@ -5673,24 +5892,170 @@ format_expand1(struct format_expand_state *es, const char *fmt)
 					s = format_lower[ch - 'a'];
 			}
 			if (s == NULL) {
-				while (len - off < 3) {
-					buf = xreallocarray(buf, 2, len);
-					len *= 2;
-				}
-				buf[off++] = '#';
-				buf[off++] = ch;
+				format_program_add_text(fp, &textlen, fmt - 2,
+				    2);
 				continue;
 			}
-			n = strlen(s);
-			format_log(es, "found #%c: %s", ch, s);
-			if (format_replace(es, s, n, &buf, &len, &off) != 0)
-				break;
+			format_program_add_step(fp, FORMAT_STEP_REPLACE,
+			    xstrdup(s), ch);
 			continue;
 		}
+		break;
+	}
+	return (fp);
+}
+
+/* Free a parsed format. */
+static void
+format_program_free(struct format_program *fp)
+{
+	struct format_step	*step;
+	u_int			 i;
+
+	RB_REMOVE(format_program_tree, &format_programs, fp);
+	TAILQ_REMOVE(&format_program_lru, fp, lru_entry);
+	format_program_count--;
+
+	for (i = 0; i < fp->nsteps; i++) {
+		step = &fp->steps[i];
+		if (step->cached)
+			format_free_modifiers(step->list, step->count);
+		free(step->s);
+	}
+	free(fp->steps);
+	free(fp->text);
+	free(fp->fmt);
+	free(fp);
+}
+
+/* Find or parse a format and add a reference to it. */
+static struct format_program *
+format_program_get(const char *fmt)
+{
+	struct format_program	 find, *fp, *loop, *prev;
+
+	find.fmt = (char *)fmt;
+	fp = RB_FIND(format_program_tree, &format_programs, &find);
+	if (fp != NULL) {
+		TAILQ_REMOVE(&format_program_lru, fp, lru_entry);
+		TAILQ_INSERT_HEAD(&format_program_lru, fp, lru_entry);
+		fp->references++;
+		return (fp);
+	}
+
+	fp = format_program_parse(fmt);
+	fp->references++;
+	RB_INSERT(format_program_tree, &format_programs, fp);
+	TAILQ_INSERT_HEAD(&format_program_lru, fp, lru_entry);
+	format_program_count++;
+
+	loop = TAILQ_LAST(&format_program_lru, format_program_list);
+	while (format_program_count > FORMAT_PROGRAM_LIMIT && loop != NULL) {
+		prev = TAILQ_PREV(loop, format_program_list, lru_entry);
+		if (loop->references == 0)
+			format_program_free(loop);
+		loop = prev;
+	}
+	return (fp);
+}
+
+/* Expand keys in a template. */
+static char *
+format_expand1(struct format_expand_state *es, const char *fmt)
+{
+	struct format_tree	*ft = es->ft;
+	struct format_program	*fp;
+	struct format_step	*step;
+	char			*buf, *out;
+	size_t			 off, len, outlen;
+	u_int			 i;
+	char			 expanded[8192];
+
+	if (fmt == NULL || *fmt == '\0')
+		return (xstrdup(""));
+
+	if (es->loop == FORMAT_LOOP_LIMIT) {
+		format_log(es, "reached loop limit (%u)", FORMAT_LOOP_LIMIT);
+		return (xstrdup(""));
+	}
+	es->loop++;
+
+	format_log(es, "expanding format: %s", fmt);
+
+	if ((es->flags & FORMAT_EXPAND_TIME) && strchr(fmt, '%') != NULL) {
+		if (es->time == 0) {
+			es->time = time(NULL);
+			localtime_r(&es->time, &es->tm);
+		}
+		if (format_strftime(expanded, sizeof expanded, fmt,
+		    &es->tm) == 0) {
+			format_log(es, "format is too long");
+			return (xstrdup(""));
+		}
+		if (format_logging(ft) && strcmp(expanded, fmt) != 0)
+			format_log(es, "after time expanded: %s", expanded);
+		fmt = expanded;
+	}
+
+	if (strchr(fmt, '#') == NULL) {
+		buf = xstrdup(fmt);
+		format_log(es, "result is: %s", buf);
+		es->loop--;
+		return (buf);
+	}
+	fp = format_program_get(fmt);
 
+	len = 64;
+	buf = xmalloc(len);
+	off = 0;
+
+	for (i = 0; i < fp->nsteps; i++) {
+		step = &fp->steps[i];
+		switch (step->type) {
+		case FORMAT_STEP_TEXT:
+			while (len - off < step->n + 1) {
+				buf = xreallocarray(buf, 2, len);
+				len *= 2;
+			}
+			memcpy(buf + off, fp->text + step->off, step->n);
+			off += step->n;
+			continue;
+		case FORMAT_STEP_JOB:
+			format_log(es, "found #(): %s", step->s);
+
+			if ((ft->flags & FORMAT_NOJOBS) ||
+			    (es->flags & FORMAT_EXPAND_NOJOBS)) {
+				out = xstrdup("");
+				format_log(es, "#() is disabled");
+			} else {
+				out = format_job_get(es, step->s);
+				format_log(es, "#() result: %s", out);
+			}
+
+			outlen = strlen(out);
+			while (len - off < outlen + 1) {
+				buf = xreallocarray(buf, 2, len);
+				len *= 2;
+			}
+			memcpy(buf + off, out, outlen);
+			off += outlen;
+
+			free(out);
+			continue;
+		case FORMAT_STEP_REPLACE:
+			if (step->alias != 0) {
+				format_log(es, "found #%c: %s", step->alias,
+				    step->s);
+			} else
+				format_log(es, "found #{}: %s", step->s);
+			if (format_replace(es, step, &buf, &len, &off) != 0)
+				break;
+			continue;
+		}
 		break;
 	}
 	buf[off] = '\0';
+	fp->references--;
 
 	format_log(es, "result is: %s", buf);
 	es->loop--;
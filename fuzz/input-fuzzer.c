@@ -26,12 +26,49 @@
 
 struct event_base *libevent;
 
+static struct window_pane *
+fuzzer_add_pane(struct window *w, struct window_pane *other,
+    struct bufferevent *bev)
+{
+	struct window_pane	*wp;
+
+	wp = window_add_pane(w, other, 0, 0);
+	wp->ictx = input_init(wp, bev, NULL);
+
+	wp->fd = open("/dev/null", O_WRONLY);
+	if (wp->fd == -1)
+		errx(1, "open(\"/dev/null\") failed");
+	wp->event = bufferevent_new(wp->fd, NULL, NULL, NULL, NULL);
+
+	return (wp);
+}
+
+static int
+fuzzer_compare_screens(struct screen *sa, struct screen *sb)
+{
+	struct grid_cell	 gca, gcb;
+	u_int			 xx, yy;
+
+	if (sa->cx != sb->cx || sa->cy != sb->cy)
+		return (1);
+	for (yy = 0; yy < screen_size_y(sa); yy++) {
+		for (xx = 0; xx < screen_size_x(sa); xx++) {
+			grid_get_cell(sa->grid, xx, yy, &gca);
+			grid_get_cell(sb->grid, xx, yy, &gcb);
+			if (!grid_cells_equal(&gca, &gcb))
+				return (1);
+		}
+	}
+	return (0);
+}
+
 int
 LLVMFuzzerTestOneInput(const u_char *data, size_t size)
 {
 	struct bufferevent	*vpty[2];
 	struct window		*w;
-	struct window_pane 	*wp;
+	struct window_pane 	*wp, *wp1;
+	size_t			 i;
 	int			 error;
 
 	/*
@@ -42,17 +79,21 @@ LLVMFuzzerTestOneInput(const u_char *data, size_t size)
 		return 0;
 
 	w = window_create(PANE_WIDTH, PANE_HEIGHT, 0, 0);
-	wp = window_add_pane(w, NULL, 0, 0);
 	bufferevent_pair_new(libevent, BEV_OPT_CLOSE_ON_FREE, vpty);
-	wp->ictx = input_init(wp, vpty[0], NULL);
+	wp = fuzzer_add_pane(w, NULL, vpty[0]);
+	wp1 = fuzzer_add_pane(w, wp, vpty[0]);
 	window_add_ref(w, __func__);
 
-	wp->fd = open("/dev/null", O_WRONLY);
-	if (wp->fd == -1)
-		errx(1, "open(\"/dev/null\") failed");
-	wp->event = bufferevent_new(wp->fd, NULL, NULL, NULL, NULL);
-
+	/*
+	 * Parse the input all at once in one pane and a byte at a time in the
+	 * other. This should give the same result: runs of printable
+	 * characters are only handled together in the first.
+	 */
 	input_parse_buffer(wp, (u_char *)data, size);
+	for (i = 0; i < size; i++)
+		input_parse_buffer(wp1, (u_char *)data + i, 1);
+	assert(fuzzer_compare_screens(&wp->base, &wp1->base) == 0);
+
 	while (cmdq_next(NULL) != 0)
 		;
 	error = event_base_loop(libevent, EVLOOP_NONBLOCK);
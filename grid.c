@@ -17,9 +17,14 @@
  */
 
 #include <sys/types.h>
+#include <sys/mman.h>
 
+#include <errno.h>
+#include <libgen.h>
+#include <paths.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 #include "tmux.h"
 
@@ -33,6 +38,28 @@
  * (hsize - 1); from hsize to hsize + (sy - 1) is the viewable data. All
  * functions in this file work on absolute coordinates, grid-view.c has
  * functions which work on the screen data.
+ *
+ * Lines are stored in fixed size blocks of GRID_BLOCK_LINES, so a line does not
+ * move in memory once it has been allocated. Line 0 is at offset lineoffset in
+ * the first block. Lines are added to the history by using the next line in
+ * the last block (adding a block when it is full) and removed from the top by
+ * advancing the offset and freeing any blocks that are now entirely unused;
+ * only the (much smaller) block pointer array is ever moved.
+ *
+ * If hcompress is set, blocks which contain only lines that are more than
+ * hcompress lines back in the history are packed into a compact form and their
+ * line data freed. They are unpacked again when any of their lines is needed.
+ *
+ * If hspill is also set, packed blocks more than hspill lines back are written
+ * to an unlinked file and their packed data freed. The file is mapped to read
+ * a block back, so finding any line is still only an index into the blocks.
+ * Space in the file is reused by rewriting it once it is more than half
+ * unused.
+ *
+ * The attributes and colours of extended cells are shared between all grids:
+ * each distinct style is stored once in a reference counted table and
+ * extended cells hold its index. Packed lines store the style itself, so only
+ * unpacked lines hold references.
  */
 
 /* Default grid cell data. */
@@ -56,6 +83,154 @@ static const struct grid_cell_entry grid_cleared_entry = {
 	{ .data = { 0, 8, 8, ' ' } }, GRID_FLAG_CLEARED
 };
 
+/* Shared style of extended cells. */
+struct grid_style {
+	u_short			attr;
+	u_char			flags;
+	int			fg;
+	int			bg;
+	int			us;
+	u_int			link;
+
+	u_int			index;
+	u_int			references;
+	RB_ENTRY(grid_style)	entry;
+};
+
+static int
+grid_style_cmp(struct grid_style *gs1, struct grid_style *gs2)
+{
+	if (gs1->attr != gs2->attr)
+		return (gs1->attr < gs2->attr ? -1 : 1);
+	if (gs1->flags != gs2->flags)
+		return (gs1->flags < gs2->flags ? -1 : 1);
+	if (gs1->fg != gs2->fg)
+		return (gs1->fg < gs2->fg ? -1 : 1);
+	if (gs1->bg != gs2->bg)
+		return (gs1->bg < gs2->bg ? -1 : 1);
+	if (gs1->us != gs2->us)
+		return (gs1->us < gs2->us ? -1 : 1);
+	if (gs1->link != gs2->link)
+		return (gs1->link < gs2->link ? -1 : 1);
+	return (0);
+}
+RB_HEAD(grid_style_tree, grid_style);
+RB_GENERATE_STATIC(grid_style_tree, grid_style, entry, grid_style_cmp);
+static struct grid_style_tree grid_style_tree =
+    RB_INITIALIZER(grid_style_tree);
+
+/*
+ * Styles by index and indexes free for reuse. Index zero is not used. Both
+ * arrays are grown by doubling so adding and releasing many styles is not
+ * quadratic.
+ */
+static struct grid_style	**grid_style_list;
+static u_int			  grid_style_size;
+static u_int			  grid_style_space;
+static u_int			 *grid_style_free;
+static u_int			  grid_style_nfree;
+static u_int			  grid_style_freespace;
+
+/* Most recently added style, since cells often share the last style. */
+static struct grid_style	 *grid_style_last;
+
+/* Get a style by index. */
+static struct grid_style *
+grid_style_get(u_int index)
+{
+	if (index == 0 || index >= grid_style_size ||
+	    grid_style_list[index] == NULL)
+		fatalx("bad grid style %u", index);
+	return (grid_style_list[index]);
+}
+
+/* Add a reference to a style, adding it to the table if it is new. */
+static u_int
+grid_style_add(const struct grid_style *find)
+{
+	struct grid_style	*gs = grid_style_last;
+	u_int			 index;
+
+	if (gs == NULL || grid_style_cmp(gs, (struct grid_style *)find) != 0)
+		gs = RB_FIND(grid_style_tree, &grid_style_tree,
+		    (struct grid_style *)find);
+	if (gs != NULL) {
+		gs->references++;
+		grid_style_last = gs;
+		return (gs->index);
+	}
+
+	if (grid_style_nfree != 0)
+		index = grid_style_free[--grid_style_nfree];
+	else {
+		if (grid_style_size == 0)
+			grid_style_size = 1;
+		index = grid_style_size++;
+		if (grid_style_size > grid_style_space) {
+			grid_style_space = grid_style_size * 2;
+			grid_style_list = xreallocarray(grid_style_list,
+			    grid_style_space, sizeof *grid_style_list);
+		}
+	}
+
+	gs = xmalloc(sizeof *gs);
+	memcpy(gs, find, sizeof *gs);
+	gs->index = index;
+	gs->references = 1;
+	RB_INSERT(grid_style_tree, &grid_style_tree, gs);
+	grid_style_list[index] = gs;
+
+	grid_style_last = gs;
+	return (index);
+}
+
+/* Add a reference to an existing style. */
+static void
+grid_style_reference(u_int index)
+{
+	if (index != 0)
+		grid_style_get(index)->references++;
+}
+
+/* Remove a reference to a style, freeing it if no longer used. */
+static void
+grid_style_release(u_int index)
+{
+	struct grid_style	*gs;
+
+	if (index == 0)
+		return;
+	gs = grid_style_get(index);
+	if (--gs->references != 0)
+		return;
+
+	RB_REMOVE(grid_style_tree, &grid_style_tree, gs);
+	grid_style_list[index] = NULL;
+	if (grid_style_last == gs)
+		grid_style_last = NULL;
+	free(gs);
+
+	if (grid_style_nfree == grid_style_freespace) {
+		grid_style_freespace = (grid_style_nfree + 1) * 2;
+		grid_style_free = xreallocarray(grid_style_free,
+		    grid_style_freespace, sizeof *grid_style_free);
+	}
+	grid_style_free[grid_style_nfree++] = index;
+}
+
+/* Free extended cells of a line, removing references to their styles. */
+static void
+grid_free_extended_cells(struct grid_line *gl)
+{
+	u_int	i;
+
+	for (i = 0; i < gl->extdsize; i++)
+		grid_style_release(gl->extddata[i].style);
+	free(gl->extddata);
+	gl->extddata = NULL;
+	gl->extdsize = 0;
+}
+
 /* Store cell in entry. */
 static void
 grid_store_cell(struct grid_cell_entry *gce, const struct grid_cell *gc,
@@ -106,6 +281,7 @@ grid_get_extended_cell(struct grid_line *gl, struct grid_cell_entry *gce,
 
 	gl->extddata = xreallocarray(gl->extddata, at, sizeof *gl->extddata);
 	gl->extdsize = at;
+	memset(&gl->extddata[at - 1], 0, sizeof *gl->extddata);
 
 	gce->offset = at - 1;
 	gce->flags = (flags | GRID_FLAG_EXTENDED);
@@ -117,8 +293,10 @@ grid_extended_cell(struct grid_line *gl, struct grid_cell_entry *gce,
     const struct grid_cell *gc)
 {
 	struct grid_extd_entry	*gee;
+	struct grid_style	 gs;
 	int			 flags = (gc->flags & ~GRID_FLAG_CLEARED);
 	utf8_char		 uc;
+	u_int			 index;
 
 	if (~gce->flags & GRID_FLAG_EXTENDED)
 		grid_get_extended_cell(gl, gce, flags);
@@ -131,14 +309,19 @@ grid_extended_cell(struct grid_line *gl, struct grid_cell_entry *gce,
 	else
 		utf8_from_data(&gc->data, &uc);
 
+	memset(&gs, 0, sizeof gs);
+	gs.attr = gc->attr;
+	gs.flags = flags;
+	gs.fg = gc->fg;
+	gs.bg = gc->bg;
+	gs.us = gc->us;
+	gs.link = gc->link;
+
 	gee = &gl->extddata[gce->offset];
 	gee->data = uc;
-	gee->attr = gc->attr;
-	gee->flags = flags;
-	gee->fg = gc->fg;
-	gee->bg = gc->bg;
-	gee->us = gc->us;
-	gee->link = gc->link;
+	index = gee->style;
+	gee->style = grid_style_add(&gs);
+	grid_style_release(index);
 	return (gee);
 }
 
@@ -162,9 +345,7 @@ grid_compact_line(struct grid_line *gl)
 	}
 
 	if (new_extdsize == 0) {
-		free(gl->extddata);
-		gl->extddata = NULL;
-		gl->extdsize = 0;
+		grid_free_extended_cells(gl);
 		return;
 	}
 	new_extddata = xreallocarray(NULL, new_extdsize, sizeof *gl->extddata);
@@ -175,43 +356,762 @@ grid_compact_line(struct grid_line *gl)
 		if (gce->flags & GRID_FLAG_EXTENDED) {
 			gee = &gl->extddata[gce->offset];
 			memcpy(&new_extddata[idx], gee, sizeof *gee);
+			grid_style_reference(gee->style);
 			gce->offset = idx++;
 		}
 	}
 
-	free(gl->extddata);
+	grid_free_extended_cells(gl);
 	gl->extddata = new_extddata;
 	gl->extdsize = new_extdsize;
 }
 
+/* Packing buffer. */
+struct grid_pack {
+	u_char	*buf;
+	size_t	 len;
+	size_t	 size;
+};
+
+/* File holding spilled blocks. */
+struct grid_spill {
+	int	 fd;
+
+	u_char	*map;
+	size_t	 mapsize;
+
+	size_t	 size;
+	size_t	 dead;
+
+	u_int	 references;
+};
+
+/* Number of grids using a shared block. */
+struct grid_share {
+	u_int	 references;
+};
+
+/* Add bytes to packing buffer. */
+static void
+grid_pack_add(struct grid_pack *gp, const void *data, size_t size)
+{
+	if (gp->len + size > gp->size) {
+		gp->size = (gp->len + size) * 2;
+		gp->buf = xrealloc(gp->buf, gp->size);
+	}
+	memcpy(gp->buf + gp->len, data, size);
+	gp->len += size;
+}
+
+/* Add a number to packing buffer, seven bits at a time. */
+static void
+grid_pack_number(struct grid_pack *gp, u_int n)
+{
+	u_char	c;
+
+	while (n >= 0x80) {
+		c = (n & 0x7f) | 0x80;
+		grid_pack_add(gp, &c, 1);
+		n >>= 7;
+	}
+	c = n;
+	grid_pack_add(gp, &c, 1);
+}
+
+/* Get bytes from packed data. */
+static void
+grid_unpack_get(const u_char **ptr, const u_char *end, void *data, size_t size)
+{
+	if ((size_t)(end - *ptr) < size)
+		fatalx("packed grid data too short");
+	memcpy(data, *ptr, size);
+	*ptr += size;
+}
+
+/* Get a number from packed data. */
+static u_int
+grid_unpack_number(const u_char **ptr, const u_char *end)
+{
+	u_int	n = 0, shift = 0;
+	u_char	c;
+
+	do {
+		grid_unpack_get(ptr, end, &c, 1);
+		n |= (u_int)(c & 0x7f) << shift;
+		shift += 7;
+	} while (c & 0x80);
+	return (n);
+}
+
+/*
+ * Pack a line. Cells are stored as runs: a count and flags, then for extended
+ * cells the offset of each, otherwise the shared attributes and colours and
+ * one byte of data for each cell (or only one if the low bit of the count is
+ * set and they are all the same). The extended cells follow with their style
+ * in place of the index.
+ */
+static void
+grid_pack_line(struct grid_pack *gp, const struct grid_line *gl)
+{
+	const struct grid_cell_entry	*gce, *first;
+	const struct grid_extd_entry	*gee;
+	const struct grid_style		*gs;
+	u_int				 px, n, i;
+	int				 same;
+
+	grid_pack_number(gp, gl->cellused);
+	grid_pack_number(gp, gl->cellsize);
+	grid_pack_number(gp, gl->extdsize);
+	grid_pack_number(gp, gl->flags);
+	grid_pack_add(gp, &gl->time, sizeof gl->time);
+
+	for (px = 0; px < gl->cellsize; px += n) {
+		first = &gl->celldata[px];
+		for (n = 1; px + n < gl->cellsize; n++) {
+			gce = &gl->celldata[px + n];
+			if (gce->flags != first->flags)
+				break;
+			if (first->flags & GRID_FLAG_EXTENDED)
+				continue;
+			if (gce->data.attr != first->data.attr ||
+			    gce->data.fg != first->data.fg ||
+			    gce->data.bg != first->data.bg)
+				break;
+		}
+		if (first->flags & GRID_FLAG_EXTENDED) {
+			grid_pack_number(gp, n << 1);
+			grid_pack_add(gp, &first->flags, 1);
+			for (i = 0; i < n; i++)
+				grid_pack_number(gp, first[i].offset);
+			continue;
+		}
+
+		same = 1;
+		for (i = 1; same && i < n; i++)
+			same = (first[i].data.data == first->data.data);
+		grid_pack_number(gp, (n << 1)|same);
+		grid_pack_add(gp, &first->flags, 1);
+		grid_pack_add(gp, &first->data.attr, 1);
+		grid_pack_add(gp, &first->data.fg, 1);
+		grid_pack_add(gp, &first->data.bg, 1);
+		if (same)
+			grid_pack_add(gp, &first->data.data, 1);
+		else {
+			for (i = 0; i < n; i++)
+				grid_pack_add(gp, &first[i].data.data, 1);
+		}
+	}
+	for (i = 0; i < gl->extdsize; i++) {
+		gee = &gl->extddata[i];
+		grid_pack_add(gp, &gee->data, sizeof gee->data);
+		if (gee->style == 0) {
+			grid_pack_add(gp, "", 1);
+			continue;
+		}
+		gs = grid_style_get(gee->style);
+		grid_pack_add(gp, "\001", 1);
+		grid_pack_add(gp, &gs->attr, sizeof gs->attr);
+		grid_pack_add(gp, &gs->flags, sizeof gs->flags);
+		grid_pack_add(gp, &gs->fg, sizeof gs->fg);
+		grid_pack_add(gp, &gs->bg, sizeof gs->bg);
+		grid_pack_add(gp, &gs->us, sizeof gs->us);
+		grid_pack_add(gp, &gs->link, sizeof gs->link);
+	}
+}
+
+/* Unpack a line. */
+static void
+grid_unpack_line(const u_char **ptr, const u_char *end, struct grid_line *gl)
+{
+	struct grid_cell_entry	*gce;
+	struct grid_extd_entry	*gee;
+	struct grid_style	 gs;
+	u_int			 px, n, i;
+	u_char			 flags, attr, fg, bg, data, style;
+	int			 same;
+
+	gl->cellused = grid_unpack_number(ptr, end);
+	gl->cellsize = grid_unpack_number(ptr, end);
+	gl->extdsize = grid_unpack_number(ptr, end);
+	gl->flags = grid_unpack_number(ptr, end);
+	grid_unpack_get(ptr, end, &gl->time, sizeof gl->time);
+
+	if (gl->cellsize != 0) {
+		gl->celldata = xreallocarray(NULL, gl->cellsize,
+		    sizeof *gl->celldata);
+	} else
+		gl->celldata = NULL;
+	for (px = 0; px < gl->cellsize; px += n) {
+		n = grid_unpack_number(ptr, end);
+		same = (n & 1);
+		n >>= 1;
+		if (n == 0 || n > gl->cellsize - px)
+			fatalx("bad packed grid run");
+		grid_unpack_get(ptr, end, &flags, 1);
+		if (flags & GRID_FLAG_EXTENDED) {
+			for (i = 0; i < n; i++) {
+				gce = &gl->celldata[px + i];
+				gce->flags = flags;
+				gce->offset = grid_unpack_number(ptr, end);
+			}
+			continue;
+		}
+		grid_unpack_get(ptr, end, &attr, 1);
+		grid_unpack_get(ptr, end, &fg, 1);
+		grid_unpack_get(ptr, end, &bg, 1);
+		if (same)
+			grid_unpack_get(ptr, end, &data, 1);
+		for (i = 0; i < n; i++) {
+			gce = &gl->celldata[px + i];
+			gce->flags = flags;
+			gce->data.attr = attr;
+			gce->data.fg = fg;
+			gce->data.bg = bg;
+			if (same)
+				gce->data.data = data;
+			else
+				grid_unpack_get(ptr, end, &gce->data.data, 1);
+		}
+	}
+
+	if (gl->extdsize != 0) {
+		gl->extddata = xreallocarray(NULL, gl->extdsize,
+		    sizeof *gl->extddata);
+	} else
+		gl->extddata = NULL;
+	for (i = 0; i < gl->extdsize; i++) {
+		gee = &gl->extddata[i];
+		grid_unpack_get(ptr, end, &gee->data, sizeof gee->data);
+		grid_unpack_get(ptr, end, &style, 1);
+		if (style == 0) {
+			gee->style = 0;
+			continue;
+		}
+		memset(&gs, 0, sizeof gs);
+		grid_unpack_get(ptr, end, &gs.attr, sizeof gs.attr);
+		grid_unpack_get(ptr, end, &gs.flags, sizeof gs.flags);
+		grid_unpack_get(ptr, end, &gs.fg, sizeof gs.fg);
+		grid_unpack_get(ptr, end, &gs.bg, sizeof gs.bg);
+		grid_unpack_get(ptr, end, &gs.us, sizeof gs.us);
+		grid_unpack_get(ptr, end, &gs.link, sizeof gs.link);
+		gee->style = grid_style_add(&gs);
+	}
+}
+
+/*
+ * Pack a block of lines. Lines before the start of the grid are already freed
+ * and are not included.
+ */
+static void
+grid_pack_block(struct grid *gd, u_int b)
+{
+	struct grid_block	*gb = &gd->lineblocks[b];
+	struct grid_pack	 gp = { 0 };
+	struct grid_line	*gl;
+	u_int			 i;
+
+	gb->packedfirst = (b == 0 ? gd->lineoffset : 0);
+	for (i = gb->packedfirst; i < GRID_BLOCK_LINES; i++) {
+		gl = &gb->linedata[i];
+		grid_pack_line(&gp, gl);
+		free(gl->celldata);
+		grid_free_extended_cells(gl);
+	}
+	free(gb->linedata);
+	gb->linedata = NULL;
+
+	gb->packed = xrealloc(gp.buf, gp.len);
+	gb->packedsize = gp.len;
+	log_debug("%s: block %u packed to %zu bytes", __func__, b, gp.len);
+}
+
+/* Open a spill file in the same directory as the server socket. */
+static struct grid_spill *
+grid_spill_open(void)
+{
+	struct grid_spill	*gs;
+	char			*copy, *path;
+	int			 fd;
+
+	if (socket_path != NULL) {
+		copy = xstrdup(socket_path);
+		xasprintf(&path, "%s/history-XXXXXX", dirname(copy));
+		free(copy);
+	} else
+		xasprintf(&path, "%stmux-history-XXXXXX", _PATH_TMP);
+	fd = mkstemp(path);
+	if (fd == -1) {
+		log_debug("%s: %s: %s", __func__, path, strerror(errno));
+		free(path);
+		return (NULL);
+	}
+	unlink(path);
+	log_debug("%s: opened %s", __func__, path);
+	free(path);
+
+	gs = xcalloc(1, sizeof *gs);
+	gs->fd = fd;
+	gs->references = 1;
+	return (gs);
+}
+
+/* Close a spill file if no other grid is using it. */
+static void
+grid_spill_close(struct grid_spill *gs)
+{
+	if (--gs->references != 0)
+		return;
+	if (gs->map != NULL)
+		munmap(gs->map, gs->mapsize);
+	close(gs->fd);
+	free(gs);
+}
+
+/* Write data at the end of a spill file. */
+static int
+grid_spill_write(struct grid_spill *gs, const u_char *data, size_t size)
+{
+	size_t	done = 0;
+	ssize_t	n;
+
+	while (done < size) {
+		n = pwrite(gs->fd, data + done, size - done, gs->size + done);
+		if (n == -1) {
+			if (errno == EINTR)
+				continue;
+			log_debug("%s: %s", __func__, strerror(errno));
+			return (-1);
+		}
+		done += n;
+	}
+	gs->size += size;
+	return (0);
+}
+
+/* Get a pointer to spilled data, mapping the file again if it has grown. */
+static const u_char *
+grid_spill_read(struct grid *gd, struct grid_block *gb)
+{
+	struct grid_spill	*gs = gd->spill;
+
+	if (gb->spilloffset + gb->packedsize > gs->mapsize) {
+		if (gs->map != NULL)
+			munmap(gs->map, gs->mapsize);
+		gs->map = mmap(NULL, gs->size, PROT_READ, MAP_SHARED, gs->fd,
+		    0);
+		if (gs->map == MAP_FAILED)
+			fatal("mmap failed");
+		gs->mapsize = gs->size;
+	}
+	return (gs->map + gb->spilloffset);
+}
+
+/*
+ * Mark spilled data as no longer used. Only the grid which wrote the file keeps
+ * count.
+ */
+static void
+grid_spill_release(struct grid *gd, struct grid_block *gb)
+{
+	if (~gd->flags & GRID_BORROWED)
+		gd->spill->dead += gb->packedsize;
+	gb->spilled = 0;
+}
+
+/* Write a packed block to the spill file and free the packed data. */
+static void
+grid_spill_block(struct grid *gd, u_int b)
+{
+	struct grid_block	*gb = &gd->lineblocks[b];
+	size_t			 offset;
+
+	if (gd->spill == NULL && (gd->spill = grid_spill_open()) == NULL)
+		return;
+	offset = gd->spill->size;
+	if (grid_spill_write(gd->spill, gb->packed, gb->packedsize) != 0)
+		return;
+
+	free(gb->packed);
+	gb->packed = NULL;
+	gb->spilled = 1;
+	gb->spilloffset = offset;
+	log_debug("%s: block %u spilled at %zu", __func__, b, offset);
+}
+
+/*
+ * Rewrite the spill file with only the blocks still in it if more than half
+ * of it is unused. If it is entirely unused, close it.
+ */
+static void
+grid_spill_compact(struct grid *gd)
+{
+	struct grid_spill	*gs = gd->spill, *new;
+	struct grid_block	*gb;
+	const u_char		*data;
+	size_t			 offset = 0;
+	u_int			 b;
+
+	if (gs == NULL || (gd->flags & GRID_BORROWED))
+		return;
+	if (gs->dead <= gs->size / 2)
+		return;
+	if (gs->dead == gs->size) {
+		grid_spill_close(gs);
+		gd->spill = NULL;
+		return;
+	}
+
+	if ((new = grid_spill_open()) == NULL)
+		return;
+	for (b = 0; b < gd->nlineblocks; b++) {
+		gb = &gd->lineblocks[b];
+		if (!gb->spilled)
+			continue;
+		data = grid_spill_read(gd, gb);
+		if (grid_spill_write(new, data, gb->packedsize) != 0) {
+			grid_spill_close(new);
+			return;
+		}
+	}
+	for (b = 0; b < gd->nlineblocks; b++) {
+		gb = &gd->lineblocks[b];
+		if (!gb->spilled)
+			continue;
+		gb->spilloffset = offset;
+		offset += gb->packedsize;
+	}
+	log_debug("%s: %zu bytes -> %zu", __func__, gs->size, new->size);
+
+	grid_spill_close(gs);
+	gd->spill = new;
+}
+
+/* Unpack a block of lines. */
+static void
+grid_unpack_block(struct grid *gd, u_int b)
+{
+	struct grid_block	*gb = &gd->lineblocks[b];
+	const u_char		*ptr, *end;
+	struct grid_line	*gl;
+	u_int			 i, first = (b == 0 ? gd->lineoffset : 0);
+
+	if (gb->spilled)
+		ptr = grid_spill_read(gd, gb);
+	else
+		ptr = gb->packed;
+	end = ptr + gb->packedsize;
+
+	gb->linedata = xcalloc(GRID_BLOCK_LINES, sizeof *gb->linedata);
+	for (i = gb->packedfirst; i < GRID_BLOCK_LINES; i++) {
+		gl = &gb->linedata[i];
+		grid_unpack_line(&ptr, end, gl);
+		if (i < first) {
+			/* Trimmed from the history while packed. */
+			free(gl->celldata);
+			grid_free_extended_cells(gl);
+			memset(gl, 0, sizeof *gl);
+		}
+	}
+	if (ptr != end)
+		fatalx("packed grid data too long");
+
+	if (gb->spilled)
+		grid_spill_release(gd, gb);
+	if (gb->share != NULL) {
+		/* The packed data now belongs to the other grid. */
+		if (--gb->share->references == 0) {
+			free(gb->share);
+			free(gb->packed);
+		}
+		gb->share = NULL;
+	} else
+		free(gb->packed);
+	gb->packed = NULL;
+	gb->packedsize = 0;
+	log_debug("%s: block %u unpacked", __func__, b);
+}
+
+/* Copy one line, including its cells. */
+static void
+grid_copy_line(struct grid_line *dstl, const struct grid_line *srcl)
+{
+	u_int	i;
+
+	memcpy(dstl, srcl, sizeof *dstl);
+	if (srcl->cellsize != 0) {
+		dstl->celldata = xreallocarray(NULL, srcl->cellsize,
+		    sizeof *dstl->celldata);
+		memcpy(dstl->celldata, srcl->celldata,
+		    srcl->cellsize * sizeof *dstl->celldata);
+	} else
+		dstl->celldata = NULL;
+	if (srcl->extdsize != 0) {
+		dstl->extdsize = srcl->extdsize;
+		dstl->extddata = xreallocarray(NULL, dstl->extdsize,
+		    sizeof *dstl->extddata);
+		memcpy(dstl->extddata, srcl->extddata, dstl->extdsize *
+		    sizeof *dstl->extddata);
+		for (i = 0; i < dstl->extdsize; i++)
+			grid_style_reference(dstl->extddata[i].style);
+	} else
+		dstl->extddata = NULL;
+}
+
+/*
+ * Stop sharing a block. If another grid is still using it, this grid gets its
+ * own copy of the lines or packed data.
+ */
+static void
+grid_unshare_block(struct grid *gd, u_int b)
+{
+	struct grid_block	*gb = &gd->lineblocks[b];
+	struct grid_line	*old = gb->linedata;
+	u_char			*packed;
+	u_int			 i, first = (b == 0 ? gd->lineoffset : 0);
+
+	if (gb->share == NULL)
+		return;
+
+	if (--gb->share->references == 0) {
+		free(gb->share);
+		gb->share = NULL;
+		if (old == NULL)
+			return;
+		for (i = 0; i < first; i++) {
+			/* Trimmed from the history while shared. */
+			free(old[i].celldata);
+			grid_free_extended_cells(&old[i]);
+			memset(&old[i], 0, sizeof old[i]);
+		}
+		return;
+	}
+	gb->share = NULL;
+
+	if (old == NULL) {
+		packed = xmalloc(gb->packedsize);
+		memcpy(packed, gb->packed, gb->packedsize);
+		gb->packed = packed;
+	} else {
+		gb->linedata = xcalloc(GRID_BLOCK_LINES, sizeof *gb->linedata);
+		for (i = first; i < GRID_BLOCK_LINES; i++)
+			grid_copy_line(&gb->linedata[i], &old[i]);
+	}
+	log_debug("%s: block %u copied", __func__, b);
+}
+
+/* Stop sharing any blocks with lines from py onwards so they may be changed. */
+void
+grid_unshare(struct grid *gd, u_int py)
+{
+	u_int	b;
+
+	for (b = (gd->lineoffset + py) / GRID_BLOCK_LINES; b < gd->nlineblocks;
+	    b++)
+		grid_unshare_block(gd, b);
+}
+
+/* Is this line in a packed block? */
+int
+grid_line_packed(struct grid *gd, u_int line)
+{
+	line += gd->lineoffset;
+	return (gd->lineblocks[line / GRID_BLOCK_LINES].linedata == NULL);
+}
+
+/* Is this line in a shared block? */
+static int
+grid_line_shared(struct grid *gd, u_int line)
+{
+	line += gd->lineoffset;
+	return (gd->lineblocks[line / GRID_BLOCK_LINES].share != NULL);
+}
+
+/* Get bytes used by packed blocks. */
+size_t
+grid_packed_size(struct grid *gd)
+{
+	size_t	size = 0;
+	u_int	b;
+
+	for (b = 0; b < gd->nlineblocks; b++) {
+		if (!gd->lineblocks[b].spilled)
+			size += gd->lineblocks[b].packedsize;
+	}
+	return (size);
+}
+
+/*
+ * Get the number of blocks where every line is further back in the history
+ * than limit.
+ */
+static u_int
+grid_cold_blocks(struct grid *gd, u_int limit)
+{
+	if (limit == 0 || gd->hsize <= limit)
+		return (0);
+	return ((gd->lineoffset + gd->hsize - limit) / GRID_BLOCK_LINES);
+}
+
+/*
+ * Pack any history blocks where every line is further back than the compress
+ * or spill limit and spill those further back than the spill limit. Blocks
+ * are unpacked when they are next used. Blocks still shared with another grid
+ * are left alone.
+ */
+void
+grid_pack_history(struct grid *gd)
+{
+	struct grid_block	*gb;
+	u_int			 n, b;
+
+	n = grid_cold_blocks(gd, gd->hcompress);
+	if (grid_cold_blocks(gd, gd->hspill) > n)
+		n = grid_cold_blocks(gd, gd->hspill);
+	for (b = 0; b < n; b++) {
+		gb = &gd->lineblocks[b];
+		if (gb->share != NULL && gb->share->references == 1)
+			grid_unshare_block(gd, b);
+		if (gb->linedata != NULL && gb->share == NULL)
+			grid_pack_block(gd, b);
+	}
+
+	n = grid_cold_blocks(gd, gd->hspill);
+	for (b = 0; b < n; b++) {
+		gb = &gd->lineblocks[b];
+		if (gb->packed != NULL && gb->share == NULL)
+			grid_spill_block(gd, b);
+	}
+	grid_spill_compact(gd);
+}
+
+/* Pack or spill history if a line has just crossed into a new cold block. */
+static void
+grid_pack_history_check(struct grid *gd)
+{
+	u_int	cold;
+
+	if (gd->hcompress != 0 && gd->hsize > gd->hcompress) {
+		cold = gd->lineoffset + gd->hsize - gd->hcompress;
+		if (cold % GRID_BLOCK_LINES == 0) {
+			grid_pack_history(gd);
+			return;
+		}
+	}
+	if (gd->hspill != 0 && gd->hsize > gd->hspill) {
+		cold = gd->lineoffset + gd->hsize - gd->hspill;
+		if (cold % GRID_BLOCK_LINES == 0)
+			grid_pack_history(gd);
+	}
+}
+
 /* Get line data. */
 struct grid_line *
 grid_get_line(struct grid *gd, u_int line)
 {
-	return (&gd->linedata[line]);
+	struct grid_block	*gb;
+
+	line += gd->lineoffset;
+	gb = &gd->lineblocks[line / GRID_BLOCK_LINES];
+	if (gb->linedata == NULL)
+		grid_unpack_block(gd, line / GRID_BLOCK_LINES);
+	return (&gb->linedata[line % GRID_BLOCK_LINES]);
 }
 
-/* Adjust number of lines. */
+/*
+ * Free a block of lines and any packed or spilled data. The last grid using a
+ * shared block frees its lines as well.
+ */
+static void
+grid_free_block(struct grid *gd, struct grid_block *gb)
+{
+	u_int	i;
+
+	if (gb->share != NULL) {
+		if (--gb->share->references != 0)
+			return;
+		free(gb->share);
+		for (i = 0; gb->linedata != NULL && i < GRID_BLOCK_LINES; i++) {
+			free(gb->linedata[i].celldata);
+			grid_free_extended_cells(&gb->linedata[i]);
+		}
+	}
+	if (gb->spilled)
+		grid_spill_release(gd, gb);
+	free(gb->linedata);
+	free(gb->packed);
+}
+
+/*
+ * Adjust number of lines. New blocks are allocated as needed and blocks
+ * entirely after the last line are freed; existing lines are not moved.
+ */
 void
 grid_adjust_lines(struct grid *gd, u_int lines)
 {
-	gd->linedata = xreallocarray(gd->linedata, lines, sizeof *gd->linedata);
+	u_int	nblocks, i;
+
+	nblocks = (gd->lineoffset + lines + GRID_BLOCK_LINES - 1) /
+	    GRID_BLOCK_LINES;
+	if (nblocks == gd->nlineblocks)
+		return;
+
+	if (nblocks < gd->nlineblocks) {
+		for (i = nblocks; i < gd->nlineblocks; i++)
+			grid_free_block(gd, &gd->lineblocks[i]);
+	}
+	if (nblocks == 0) {
+		free(gd->lineblocks);
+		gd->lineblocks = NULL;
+		gd->nlineblocks = 0;
+		gd->lineoffset = 0;
+		return;
+	}
+	gd->lineblocks = xreallocarray(gd->lineblocks, nblocks,
+	    sizeof *gd->lineblocks);
+	for (i = gd->nlineblocks; i < nblocks; i++) {
+		memset(&gd->lineblocks[i], 0, sizeof gd->lineblocks[i]);
+		gd->lineblocks[i].linedata = xcalloc(GRID_BLOCK_LINES,
+		    sizeof *gd->lineblocks[i].linedata);
+	}
+	gd->nlineblocks = nblocks;
+}
+
+/* Move line structures (not the cells they point to) within the grid. */
+static void
+grid_shift_lines(struct grid *gd, u_int dy, u_int py, u_int ny)
+{
+	u_int	yy;
+
+	if (dy < py) {
+		for (yy = 0; yy < ny; yy++) {
+			memcpy(grid_get_line(gd, dy + yy),
+			    grid_get_line(gd, py + yy),
+			    sizeof (struct grid_line));
+		}
+	} else {
+		for (yy = ny; yy > 0; yy--) {
+			memcpy(grid_get_line(gd, dy + yy - 1),
+			    grid_get_line(gd, py + yy - 1),
+			    sizeof (struct grid_line));
+		}
+	}
 }
 
 /* Copy default into a cell. */
 static void
 grid_clear_cell(struct grid *gd, u_int px, u_int py, u_int bg)
 {
-	struct grid_line	*gl = &gd->linedata[py];
+	struct grid_line	*gl = grid_get_line(gd, py);
 	struct grid_cell_entry	*gce = &gl->celldata[px];
-	struct grid_extd_entry	*gee;
+	struct grid_cell	 gc;
 
 	memcpy(gce, &grid_cleared_entry, sizeof *gce);
 	if (bg != 8) {
 		if (bg & COLOUR_FLAG_RGB) {
+			memcpy(&gc, &grid_cleared_cell, sizeof gc);
+			gc.bg = bg;
 			grid_get_extended_cell(gl, gce, gce->flags);
-			gee = grid_extended_cell(gl, gce, &grid_cleared_cell);
-			gee->bg = bg;
+			grid_extended_cell(gl, gce, &gc);
 		} else {
 			if (bg & COLOUR_FLAG_256)
 				gce->flags |= GRID_FLAG_BG256;
@@ -276,10 +1176,11 @@ grid_set_tab(struct grid_cell *gc, u_int width)
 static void
 grid_free_line(struct grid *gd, u_int py)
 {
-	free(gd->linedata[py].celldata);
-	gd->linedata[py].celldata = NULL;
-	free(gd->linedata[py].extddata);
-	gd->linedata[py].extddata = NULL;
+	struct grid_line	*gl = grid_get_line(gd, py);
+
+	free(gl->celldata);
+	gl->celldata = NULL;
+	grid_free_extended_cells(gl);
 }
 
 /* Free several lines. */
@@ -292,6 +1193,21 @@ grid_free_lines(struct grid *gd, u_int py, u_int ny)
 		grid_free_line(gd, yy);
 }
 
+/*
+ * Free lines without unpacking them. Lines in packed or shared blocks are
+ * freed with the block.
+ */
+static void
+grid_discard_lines(struct grid *gd, u_int py, u_int ny)
+{
+	u_int	yy;
+
+	for (yy = py; yy < py + ny; yy++) {
+		if (!grid_line_packed(gd, yy) && !grid_line_shared(gd, yy))
+			grid_free_line(gd, yy);
+	}
+}
+
 /* Create a new grid. */
 struct grid *
 grid_create(u_int sx, u_int sy, u_int hlimit)
@@ -311,10 +1227,14 @@ grid_create(u_int sx, u_int sy, u_int hlimit)
 	gd->hsize = 0;
 	gd->hlimit = hlimit;
 
-	if (gd->sy != 0)
-		gd->linedata = xcalloc(gd->sy, sizeof *gd->linedata);
-	else
-		gd->linedata = NULL;
+	gd->hcompress = 0;
+	gd->hspill = 0;
+	gd->spill = NULL;
+
+	gd->lineblocks = NULL;
+	gd->nlineblocks = 0;
+	gd->lineoffset = 0;
+	grid_adjust_lines(gd, gd->sy);
 
 	return (gd);
 }
@@ -323,9 +1243,15 @@ grid_create(u_int sx, u_int sy, u_int hlimit)
 void
 grid_destroy(struct grid *gd)
 {
-	grid_free_lines(gd, 0, gd->hsize + gd->sy);
+	u_int	i;
+
+	grid_discard_lines(gd, 0, gd->hsize + gd->sy);
 
-	free(gd->linedata);
+	for (i = 0; i < gd->nlineblocks; i++)
+		grid_free_block(gd, &gd->lineblocks[i]);
+	free(gd->lineblocks);
+	if (gd->spill != NULL)
+		grid_spill_close(gd->spill);
 
 	free(gd);
 }
@@ -342,8 +1268,8 @@ grid_compare(struct grid *ga, struct grid *gb)
 		return (1);
 
 	for (yy = 0; yy < ga->sy; yy++) {
-		gla = &ga->linedata[yy];
-		glb = &gb->linedata[yy];
+		gla = grid_get_line(ga, yy);
+		glb = grid_get_line(gb, yy);
 		if (gla->cellsize != glb->cellsize)
 			return (1);
 		for (xx = 0; xx < gla->cellsize; xx++) {
@@ -361,13 +1287,20 @@ grid_compare(struct grid *ga, struct grid *gb)
 static void
 grid_trim_history(struct grid *gd, u_int ny)
 {
-	u_int	remaining;
+	u_int	n, i;
 
-	grid_free_lines(gd, 0, ny);
-	remaining = gd->hsize + gd->sy - ny;
-	memmove(&gd->linedata[0], &gd->linedata[ny],
-	    remaining * (sizeof *gd->linedata));
-	memset(&gd->linedata[remaining], 0, ny * (sizeof *gd->linedata));
+	grid_discard_lines(gd, 0, ny);
+	gd->lineoffset += ny;
+
+	n = gd->lineoffset / GRID_BLOCK_LINES;
+	if (n == 0)
+		return;
+	for (i = 0; i < n; i++)
+		grid_free_block(gd, &gd->lineblocks[i]);
+	memmove(&gd->lineblocks[0], &gd->lineblocks[n],
+	    (gd->nlineblocks - n) * sizeof *gd->lineblocks);
+	gd->nlineblocks -= n;
+	gd->lineoffset -= n * GRID_BLOCK_LINES;
 }
 
 /*
@@ -392,7 +1325,7 @@ grid_collect_history(struct grid *gd, int all)
 		ny = gd->hsize;
 
 	/*
-	 * Free the lines from 0 to ny then move the remaining lines over
+	 * Free the lines from 0 to ny then move the start of the grid over
 	 * them.
 	 */
 	grid_trim_history(gd, ny);
@@ -402,6 +1335,20 @@ grid_collect_history(struct grid *gd, int all)
 		gd->hscrolled = gd->hsize;
 }
 
+/* Remove lines from the top of the history, for example once they are read. */
+void
+grid_remove_top_history(struct grid *gd, u_int ny)
+{
+	if (ny > gd->hsize)
+		ny = gd->hsize;
+	if (ny == 0)
+		return;
+	grid_trim_history(gd, ny);
+	gd->hsize -= ny;
+	if (gd->hscrolled > gd->hsize)
+		gd->hscrolled = gd->hsize;
+}
+
 /* Remove lines from the bottom of the history. */
 void
 grid_remove_history(struct grid *gd, u_int ny)
@@ -410,6 +1357,7 @@ grid_remove_history(struct grid *gd, u_int ny)
 
 	if (ny > gd->hsize)
 		return;
+	grid_unshare(gd, gd->hsize - ny);
 	for (yy = 0; yy < ny; yy++)
 		grid_free_line(gd, gd->hsize + gd->sy - 1 - yy);
 	gd->hsize -= ny;
@@ -425,14 +1373,15 @@ grid_scroll_history(struct grid *gd, u_int bg)
 	u_int	yy;
 
 	yy = gd->hsize + gd->sy;
-	gd->linedata = xreallocarray(gd->linedata, yy + 1,
-	    sizeof *gd->linedata);
+	grid_adjust_lines(gd, yy + 1);
 	grid_empty_line(gd, yy, bg);
 
 	gd->hscrolled++;
-	grid_compact_line(&gd->linedata[gd->hsize]);
-	gd->linedata[gd->hsize].time = current_time;
+	grid_compact_line(grid_get_line(gd, gd->hsize));
+	grid_get_line(gd, gd->hsize)->time = current_time;
 	gd->hsize++;
+
+	grid_pack_history_check(gd);
 }
 
 /* Clear the history. */
@@ -444,42 +1393,41 @@ grid_clear_history(struct grid *gd)
 	gd->hscrolled = 0;
 	gd->hsize = 0;
 
-	gd->linedata = xreallocarray(gd->linedata, gd->sy,
-	    sizeof *gd->linedata);
+	grid_adjust_lines(gd, gd->sy);
 }
 
 /* Scroll a region up, moving the top line into the history. */
 void
 grid_scroll_history_region(struct grid *gd, u_int upper, u_int lower, u_int bg)
 {
-	struct grid_line	*gl_history, *gl_upper;
+	struct grid_line	*gl_history;
 	u_int			 yy;
 
 	/* Create a space for a new line. */
 	yy = gd->hsize + gd->sy;
-	gd->linedata = xreallocarray(gd->linedata, yy + 1,
-	    sizeof *gd->linedata);
+	grid_adjust_lines(gd, yy + 1);
 
 	/* Move the entire screen down to free a space for this line. */
-	gl_history = &gd->linedata[gd->hsize];
-	memmove(gl_history + 1, gl_history, gd->sy * sizeof *gl_history);
+	grid_shift_lines(gd, gd->hsize + 1, gd->hsize, gd->sy);
 
 	/* Adjust the region and find its start and end. */
 	upper++;
-	gl_upper = &gd->linedata[upper];
 	lower++;
 
 	/* Move the line into the history. */
-	memcpy(gl_history, gl_upper, sizeof *gl_history);
+	gl_history = grid_get_line(gd, gd->hsize);
+	memcpy(gl_history, grid_get_line(gd, upper), sizeof *gl_history);
 	gl_history->time = current_time;
 
 	/* Then move the region up and clear the bottom line. */
-	memmove(gl_upper, gl_upper + 1, (lower - upper) * sizeof *gl_upper);
+	grid_shift_lines(gd, upper, upper + 1, lower - upper);
 	grid_empty_line(gd, lower, bg);
 
 	/* Move the history offset down over the line. */
 	gd->hscrolled++;
 	gd->hsize++;
+
+	grid_pack_history_check(gd);
 }
 
 /* Expand line to fit to cell. */
@@ -489,7 +1437,7 @@ grid_expand_line(struct grid *gd, u_int py, u_int sx, u_int bg)
 	struct grid_line	*gl;
 	u_int			 xx;
 
-	gl = &gd->linedata[py];
+	gl = grid_get_line(gd, py);
 	if (sx <= gl->cellsize)
 		return;
 
@@ -510,7 +1458,7 @@ grid_expand_line(struct grid *gd, u_int py, u_int sx, u_int bg)
 void
 grid_empty_line(struct grid *gd, u_int py, u_int bg)
 {
-	memset(&gd->linedata[py], 0, sizeof gd->linedata[py]);
+	memset(grid_get_line(gd, py), 0, sizeof (struct grid_line));
 	if (!COLOUR_DEFAULT(bg))
 		grid_expand_line(gd, py, gd->sx, bg);
 }
@@ -521,7 +1469,20 @@ grid_peek_line(struct grid *gd, u_int py)
 {
 	if (grid_check_y(gd, __func__, py) != 0)
 		return (NULL);
-	return (&gd->linedata[py]);
+	return (grid_get_line(gd, py));
+}
+
+/* Get the flags of a cell in a line, including those of an extended cell. */
+int
+grid_cell_flags(const struct grid_line *gl, u_int px)
+{
+	const struct grid_cell_entry	*gce = &gl->celldata[px];
+
+	if (~gce->flags & GRID_FLAG_EXTENDED)
+		return (gce->flags & ~(GRID_FLAG_FG256|GRID_FLAG_BG256));
+	if (gce->offset >= gl->extdsize)
+		return (grid_default_cell.flags);
+	return (grid_style_get(gl->extddata[gce->offset].style)->flags);
 }
 
 /* Get cell from line. */
@@ -530,18 +1491,20 @@ grid_get_cell1(struct grid_line *gl, u_int px, struct grid_cell *gc)
 {
 	struct grid_cell_entry	*gce = &gl->celldata[px];
 	struct grid_extd_entry	*gee;
+	struct grid_style	*gs;
 
 	if (gce->flags & GRID_FLAG_EXTENDED) {
 		if (gce->offset >= gl->extdsize)
 			memcpy(gc, &grid_default_cell, sizeof *gc);
 		else {
 			gee = &gl->extddata[gce->offset];
-			gc->flags = gee->flags;
-			gc->attr = gee->attr;
-			gc->fg = gee->fg;
-			gc->bg = gee->bg;
-			gc->us = gee->us;
-			gc->link = gee->link;
+			gs = grid_style_get(gee->style);
+			gc->flags = gs->flags;
+			gc->attr = gs->attr;
+			gc->fg = gs->fg;
+			gc->bg = gs->bg;
+			gc->us = gs->us;
+			gc->link = gs->link;
 
 			if (gc->flags & GRID_FLAG_TAB)
 				grid_set_tab(gc, gee->data);
@@ -569,10 +1532,10 @@ void
 grid_get_cell(struct grid *gd, u_int px, u_int py, struct grid_cell *gc)
 {
 	if (grid_check_y(gd, __func__, py) != 0 ||
-	    px >= gd->linedata[py].cellsize)
+	    px >= grid_get_line(gd, py)->cellsize)
 		memcpy(gc, &grid_default_cell, sizeof *gc);
 	else
-		grid_get_cell1(&gd->linedata[py], px, gc);
+		grid_get_cell1(grid_get_line(gd, py), px, gc);
 }
 
 /* Set cell at position. */
@@ -587,7 +1550,7 @@ grid_set_cell(struct grid *gd, u_int px, u_int py, const struct grid_cell *gc)
 
 	grid_expand_line(gd, py, px + 1, 8);
 
-	gl = &gd->linedata[py];
+	gl = grid_get_line(gd, py);
 	if (px + 1 > gl->cellused)
 		gl->cellused = px + 1;
 
@@ -620,7 +1583,7 @@ grid_set_cells(struct grid *gd, u_int px, u_int py, const struct grid_cell *gc,
 
 	grid_expand_line(gd, py, px + slen, 8);
 
-	gl = &gd->linedata[py];
+	gl = grid_get_line(gd, py);
 	if (px + slen > gl->cellused)
 		gl->cellused = px + slen;
 
@@ -655,7 +1618,7 @@ grid_clear(struct grid *gd, u_int px, u_int py, u_int nx, u_int ny, u_int bg)
 		return;
 
 	for (yy = py; yy < py + ny; yy++) {
-		gl = &gd->linedata[yy];
+		gl = grid_get_line(gd, yy);
 
 		sx = gd->sx;
 		if (sx > gl->cellsize)
@@ -693,7 +1656,7 @@ grid_clear_lines(struct grid *gd, u_int py, u_int ny, u_int bg)
 		grid_empty_line(gd, yy, bg);
 	}
 	if (py != 0)
-		gd->linedata[py - 1].flags &= ~GRID_LINE_WRAPPED;
+		grid_get_line(gd, py - 1)->flags &= ~GRID_LINE_WRAPPED;
 }
 
 /* Move a group of lines. */
@@ -721,10 +1684,9 @@ grid_move_lines(struct grid *gd, u_int dy, u_int py, u_int ny, u_int bg)
 		grid_free_line(gd, yy);
 	}
 	if (dy != 0)
-		gd->linedata[dy - 1].flags &= ~GRID_LINE_WRAPPED;
+		grid_get_line(gd, dy - 1)->flags &= ~GRID_LINE_WRAPPED;
 
-	memmove(&gd->linedata[dy], &gd->linedata[py],
-	    ny * (sizeof *gd->linedata));
+	grid_shift_lines(gd, dy, py, ny);
 
 	/*
 	 * Wipe any lines that have been moved (without freeing them - they are
@@ -735,7 +1697,7 @@ grid_move_lines(struct grid *gd, u_int dy, u_int py, u_int ny, u_int bg)
 			grid_empty_line(gd, yy, bg);
 	}
 	if (py != 0 && (py < dy || py >= dy + ny))
-		gd->linedata[py - 1].flags &= ~GRID_LINE_WRAPPED;
+		grid_get_line(gd, py - 1)->flags &= ~GRID_LINE_WRAPPED;
 }
 
 /* Move a group of cells. */
@@ -751,7 +1713,7 @@ grid_move_cells(struct grid *gd, u_int dx, u_int px, u_int py, u_int nx,
 
 	if (grid_check_y(gd, __func__, py) != 0)
 		return;
-	gl = &gd->linedata[py];
+	gl = grid_get_line(gd, py);
 
 	grid_expand_line(gd, py, px + nx, 8);
 	grid_expand_line(gd, py, dx + nx, 8);
@@ -1164,8 +2126,7 @@ void
 grid_duplicate_lines(struct grid *dst, u_int dy, struct grid *src, u_int sy,
     u_int ny)
 {
-	struct grid_line	*dstl, *srcl;
-	u_int			 yy;
+	u_int	yy;
 
 	if (dy + ny > dst->hsize + dst->sy)
 		ny = dst->hsize + dst->sy - dy;
@@ -1174,29 +2135,63 @@ grid_duplicate_lines(struct grid *dst, u_int dy, struct grid *src, u_int sy,
 	grid_free_lines(dst, dy, ny);
 
 	for (yy = 0; yy < ny; yy++) {
-		srcl = &src->linedata[sy];
-		dstl = &dst->linedata[dy];
-
-		memcpy(dstl, srcl, sizeof *dstl);
-		if (srcl->cellsize != 0) {
-			dstl->celldata = xreallocarray(NULL,
-			    srcl->cellsize, sizeof *dstl->celldata);
-			memcpy(dstl->celldata, srcl->celldata,
-			    srcl->cellsize * sizeof *dstl->celldata);
-		} else
-			dstl->celldata = NULL;
-		if (srcl->extdsize != 0) {
-			dstl->extdsize = srcl->extdsize;
-			dstl->extddata = xreallocarray(NULL, dstl->extdsize,
-			    sizeof *dstl->extddata);
-			memcpy(dstl->extddata, srcl->extddata, dstl->extdsize *
-			    sizeof *dstl->extddata);
-		} else
-			dstl->extddata = NULL;
-
+		grid_copy_line(grid_get_line(dst, dy), grid_get_line(src, sy));
 		sy++;
 		dy++;
 	}
+
+	/* Reading the source may have unpacked it, so pack it again. */
+	grid_pack_history(src);
+}
+
+/*
+ * Replace the contents of a new grid with the first ny lines of src, which
+ * must include all of its history. Blocks entirely in the history are shared
+ * rather than copied and each grid takes its own copy only if it needs to
+ * change them, so this does not depend on the size of the history.
+ */
+void
+grid_share_lines(struct grid *dst, struct grid *src, u_int ny)
+{
+	struct grid_block	*gb;
+	u_int			 n, b, first;
+
+	n = (src->lineoffset + src->hsize) / GRID_BLOCK_LINES;
+
+	grid_discard_lines(dst, 0, dst->hsize + dst->sy);
+	grid_adjust_lines(dst, 0);
+	dst->hsize = src->hsize;
+	dst->sy = ny - src->hsize;
+
+	if (n != 0)
+		dst->lineblocks = xreallocarray(NULL, n, sizeof *dst->lineblocks);
+	for (b = 0; b < n; b++) {
+		gb = &src->lineblocks[b];
+		if (gb->spilled) {
+			if (dst->spill == NULL) {
+				dst->spill = src->spill;
+				dst->spill->references++;
+				dst->flags |= GRID_BORROWED;
+			}
+		} else {
+			if (gb->share == NULL) {
+				gb->share = xcalloc(1, sizeof *gb->share);
+				gb->share->references = 1;
+			}
+			gb->share->references++;
+		}
+		memcpy(&dst->lineblocks[b], gb, sizeof dst->lineblocks[b]);
+	}
+	dst->nlineblocks = n;
+	dst->lineoffset = src->lineoffset;
+	grid_adjust_lines(dst, ny);
+	log_debug("%s: %u blocks shared", __func__, n);
+
+	if (n == 0)
+		first = 0;
+	else
+		first = n * GRID_BLOCK_LINES - src->lineoffset;
+	grid_duplicate_lines(dst, first, src, first, ny - first);
 }
 
 /* Mark line as dead. */
@@ -1211,14 +2206,14 @@ grid_reflow_dead(struct grid_line *gl)
 static struct grid_line *
 grid_reflow_add(struct grid *gd, u_int n)
 {
-	struct grid_line	*gl;
-	u_int			 sy = gd->sy + n;
+	u_int	sy = gd->sy + n, yy;
 
-	gd->linedata = xreallocarray(gd->linedata, sy, sizeof *gd->linedata);
-	gl = &gd->linedata[gd->sy];
-	memset(gl, 0, n * (sizeof *gl));
+	grid_adjust_lines(gd, sy);
+	for (yy = gd->sy; yy < sy; yy++)
+		memset(grid_get_line(gd, yy), 0, sizeof (struct grid_line));
+	yy = gd->sy;
 	gd->sy = sy;
-	return (gl);
+	return (grid_get_line(gd, yy));
 }
 
 /* Move a line across. */
@@ -1249,10 +2244,10 @@ grid_reflow_join(struct grid *target, struct grid *gd, u_int sx, u_int yy,
 	 */
 	if (!already) {
 		to = target->sy;
-		gl = grid_reflow_move(target, &gd->linedata[yy]);
+		gl = grid_reflow_move(target, grid_get_line(gd, yy));
 	} else {
 		to = target->sy - 1;
-		gl = &target->linedata[to];
+		gl = grid_get_line(target, to);
 	}
 	at = gl->cellused;
 
@@ -1270,9 +2265,9 @@ grid_reflow_join(struct grid *target, struct grid *gd, u_int sx, u_int yy,
 		line = yy + 1 + lines;
 
 		/* If the next line is empty, skip it. */
-		if (~gd->linedata[line].flags & GRID_LINE_WRAPPED)
+		if (~grid_get_line(gd, line)->flags & GRID_LINE_WRAPPED)
 			wrapped = 0;
-		if (gd->linedata[line].cellused == 0) {
+		if (grid_get_line(gd, line)->cellused == 0) {
 			if (!wrapped)
 				break;
 			lines++;
@@ -1284,7 +2279,7 @@ grid_reflow_join(struct grid *target, struct grid *gd, u_int sx, u_int yy,
 		 * separately because we need to leave "from" set to the last
 		 * line if this line is full.
 		 */
-		grid_get_cell1(&gd->linedata[line], 0, &gc);
+		grid_get_cell1(grid_get_line(gd, line), 0, &gc);
 		if (width + gc.data.width > sx)
 			break;
 		width += gc.data.width;
@@ -1292,7 +2287,7 @@ grid_reflow_join(struct grid *target, struct grid *gd, u_int sx, u_int yy,
 		at++;
 
 		/* Join as much more as possible onto the current line. */
-		from = &gd->linedata[line];
+		from = grid_get_line(gd, line);
 		for (want = 1; want < from->cellused; want++) {
 			grid_get_cell1(from, want, &gc);
 			if (width + gc.data.width > sx)
@@ -1329,9 +2324,9 @@ grid_reflow_join(struct grid *target, struct grid *gd, u_int sx, u_int yy,
 
 	/* Remove the lines that were completely consumed. */
 	for (i = yy + 1; i < yy + 1 + lines; i++) {
-		free(gd->linedata[i].celldata);
-		free(gd->linedata[i].extddata);
-		grid_reflow_dead(&gd->linedata[i]);
+		free(grid_get_line(gd, i)->celldata);
+		grid_free_extended_cells(grid_get_line(gd, i));
+		grid_reflow_dead(grid_get_line(gd, i));
 	}
 
 	/* Adjust scroll position. */
@@ -1346,7 +2341,7 @@ static void
 grid_reflow_split(struct grid *target, struct grid *gd, u_int sx, u_int yy,
     u_int at)
 {
-	struct grid_line	*gl = &gd->linedata[yy], *first;
+	struct grid_line	*gl = grid_get_line(gd, yy), *first;
 	struct grid_cell	 gc;
 	u_int			 line, lines, width, i, xx;
 	u_int			 used = gl->cellused;
@@ -1378,7 +2373,7 @@ grid_reflow_split(struct grid *target, struct grid *gd, u_int sx, u_int yy,
 	for (i = at; i < used; i++) {
 		grid_get_cell1(gl, i, &gc);
 		if (width + gc.data.width > sx) {
-			target->linedata[line].flags |= GRID_LINE_WRAPPED;
+			grid_get_line(target, line)->flags |= GRID_LINE_WRAPPED;
 
 			line++;
 			width = 0;
@@ -1389,7 +2384,7 @@ grid_reflow_split(struct grid *target, struct grid *gd, u_int sx, u_int yy,
 		xx++;
 	}
 	if (flags & GRID_LINE_WRAPPED)
-		target->linedata[line].flags |= GRID_LINE_WRAPPED;
+		grid_get_line(target, line)->flags |= GRID_LINE_WRAPPED;
 
 	/* Move the remainder of the original line. */
 	gl->cellsize = gl->cellused = at;
@@ -1423,12 +2418,13 @@ grid_reflow(struct grid *gd, u_int sx)
 	 * line data and may not be fully valid.
 	 */
 	target = grid_create(gd->sx, 0, 0);
+	grid_unshare(gd, 0);
 
 	/*
 	 * Loop over each source line.
 	 */
 	for (yy = 0; yy < gd->hsize + gd->sy; yy++) {
-		gl = &gd->linedata[yy];
+		gl = grid_get_line(gd, yy);
 		if (gl->flags & GRID_LINE_DEAD)
 			continue;
 
@@ -1489,9 +2485,15 @@ grid_reflow(struct grid *gd, u_int sx)
 	gd->hsize = target->sy - gd->sy;
 	if (gd->hscrolled > gd->hsize)
 		gd->hscrolled = gd->hsize;
-	free(gd->linedata);
-	gd->linedata = target->linedata;
+	for (i = 0; i < gd->nlineblocks; i++)
+		grid_free_block(gd, &gd->lineblocks[i]);
+	free(gd->lineblocks);
+	gd->lineblocks = target->lineblocks;
+	gd->nlineblocks = target->nlineblocks;
+	gd->lineoffset = target->lineoffset;
 	free(target);
+
+	grid_pack_history(gd);
 }
 
 /* Convert to position based on wrapped lines. */
@@ -1501,14 +2503,14 @@ grid_wrap_position(struct grid *gd, u_int px, u_int py, u_int *wx, u_int *wy)
 	u_int	ax = 0, ay = 0, yy;
 
 	for (yy = 0; yy < py; yy++) {
-		if (gd->linedata[yy].flags & GRID_LINE_WRAPPED)
-			ax += gd->linedata[yy].cellused;
+		if (grid_get_line(gd, yy)->flags & GRID_LINE_WRAPPED)
+			ax += grid_get_line(gd, yy)->cellused;
 		else {
 			ax = 0;
 			ay++;
 		}
 	}
-	if (px >= gd->linedata[yy].cellused)
+	if (px >= grid_get_line(gd, yy)->cellused)
 		ax = UINT_MAX;
 	else
 		ax += px;
@@ -1525,7 +2527,7 @@ grid_unwrap_position(struct grid *gd, u_int *px, u_int *py, u_int wx, u_int wy)
 	for (yy = 0; yy < gd->hsize + gd->sy - 1; yy++) {
 		if (ay == wy)
 			break;
-		if (~gd->linedata[yy].flags & GRID_LINE_WRAPPED)
+		if (~grid_get_line(gd, yy)->flags & GRID_LINE_WRAPPED)
 			ay++;
 	}
 
@@ -1534,14 +2536,14 @@ grid_unwrap_position(struct grid *gd, u_int *px, u_int *py, u_int wx, u_int wy)
 	 * until we find the end or the line now containing wx.
 	 */
 	if (wx == UINT_MAX) {
-		while (gd->linedata[yy].flags & GRID_LINE_WRAPPED)
+		while (grid_get_line(gd, yy)->flags & GRID_LINE_WRAPPED)
 			yy++;
-		wx = gd->linedata[yy].cellused;
+		wx = grid_get_line(gd, yy)->cellused;
 	} else {
-		while (gd->linedata[yy].flags & GRID_LINE_WRAPPED) {
-			if (wx < gd->linedata[yy].cellused)
+		while (grid_get_line(gd, yy)->flags & GRID_LINE_WRAPPED) {
+			if (wx < grid_get_line(gd, yy)->cellused)
 				break;
-			wx -= gd->linedata[yy].cellused;
+			wx -= grid_get_line(gd, yy)->cellused;
 			yy++;
 		}
 	}
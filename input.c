@@ -191,6 +191,7 @@ static void	input_enter_apc(struct input_ctx *);
 static void	input_exit_apc(struct input_ctx *);
 static void	input_enter_rename(struct input_ctx *);
 static void	input_exit_rename(struct input_ctx *);
+static void	input_print_ascii(struct input_ctx *, const u_char *, size_t);
 
 /* Input state handlers. */
 static int	input_print(struct input_ctx *);
@@ -953,6 +954,31 @@ input_set_state(struct input_ctx *ictx, const struct input_transition *itr)
 		ictx->state->enter(ictx);
 }
 
+/*
+ * Find the length of a run of printable ASCII characters at the start of a
+ * buffer, checking a word at a time where possible.
+ */
+static size_t
+input_ascii_span(const u_char *buf, size_t len)
+{
+	const uint64_t	ones = 0x0101010101010101ULL;
+	const uint64_t	highs = 0x8080808080808080ULL;
+	uint64_t	w;
+	size_t		off = 0;
+
+	while (len - off >= sizeof w) {
+		memcpy(&w, buf + off, sizeof w);
+
+		/* Any byte below 0x20, 0x7f or with the top bit set. */
+		if (((w - ones * 0x20) | (w + ones) | w) & highs)
+			break;
+		off += sizeof w;
+	}
+	while (off < len && buf[off] >= 0x20 && buf[off] <= 0x7e)
+		off++;
+	return (off);
+}
+
 /* Parse data. */
 static void
 input_parse(struct input_ctx *ictx, u_char *buf, size_t len)
@@ -960,10 +986,24 @@ input_parse(struct input_ctx *ictx, u_char *buf, size_t len)
 	struct screen_write_ctx		*sctx = &ictx->ctx;
 	const struct input_state	*state = NULL;
 	const struct input_transition	*itr = NULL;
-	size_t				 off = 0;
+	size_t				 off = 0, n;
 
 	/* Parse the input. */
 	while (off < len) {
+		/*
+		 * Printable ASCII in the ground state is always printed, so
+		 * pass a run of more than one character to the screen at once.
+		 */
+		if (ictx->state == &input_state_ground &&
+		    buf[off] >= 0x20 && buf[off] <= 0x7e) {
+			n = input_ascii_span(buf + off, len - off);
+			if (n > 1) {
+				input_print_ascii(ictx, buf + off, n);
+				off += n;
+				continue;
+			}
+		}
+
 		ictx->ch = buf[off++];
 
 		/* Find the transition. */
@@ -1232,6 +1272,30 @@ input_print(struct input_ctx *ictx)
 	return (0);
 }
 
+/* Output a run of printable ASCII characters to the screen. */
+static void
+input_print_ascii(struct input_ctx *ictx, const u_char *buf, size_t len)
+{
+	struct screen_write_ctx	*sctx = &ictx->ctx;
+	int			 set;
+
+	input_stop_utf8(ictx); /* can't be valid UTF-8 */
+
+	set = ictx->cell.set == 0 ? ictx->cell.g0set : ictx->cell.g1set;
+	if (set == 1)
+		ictx->cell.cell.attr |= GRID_ATTR_CHARSET;
+	else
+		ictx->cell.cell.attr &= ~GRID_ATTR_CHARSET;
+	screen_write_collect_ascii(sctx, &ictx->cell.cell, buf, len);
+
+	ictx->ch = buf[len - 1];
+	utf8_set(&ictx->cell.cell.data, ictx->ch);
+	utf8_copy(&ictx->last, &ictx->cell.cell.data);
+	ictx->flags |= INPUT_LAST;
+
+	ictx->cell.cell.attr &= ~GRID_ATTR_CHARSET;
+}
+
 /* Collect intermediate string. */
 static int
 input_intermediate(struct input_ctx *ictx)
@@ -502,6 +502,16 @@ const struct options_table_entry options_table[] = {
 	  .text = "Maximum number of commands to keep in history."
 	},
 
+	{ .name = "redraw-rate",
+	  .type = OPTIONS_TABLE_NUMBER,
+	  .scope = OPTIONS_TABLE_SERVER,
+	  .minimum = 0,
+	  .maximum = 1000,
+	  .default_num = 0,
+	  .text = "Maximum number of times each client is redrawn a second, "
+		  "or zero for no limit."
+	},
+
 	{ .name = "set-clipboard",
 	  .type = OPTIONS_TABLE_CHOICE,
 	  .scope = OPTIONS_TABLE_SERVER,
@@ -671,6 +681,18 @@ const struct options_table_entry options_table[] = {
 	  .text = "Whether moving the mouse into a pane selects it."
 	},
 
+	{ .name = "history-compress",
+	  .type = OPTIONS_TABLE_NUMBER,
+	  .scope = OPTIONS_TABLE_SESSION,
+	  .minimum = 0,
+	  .maximum = INT_MAX,
+	  .default_num = 0,
+	  .unit = "lines",
+	  .text = "Number of lines of history after which older lines are "
+		  "compressed. "
+		  "Zero means history is not compressed."
+	},
+
 	{ .name = "history-limit",
 	  .type = OPTIONS_TABLE_NUMBER,
 	  .scope = OPTIONS_TABLE_SESSION,
@@ -683,6 +705,18 @@ const struct options_table_entry options_table[] = {
 		  "If changed, the new value applies only to new panes."
 	},
 
+	{ .name = "history-spill",
+	  .type = OPTIONS_TABLE_NUMBER,
+	  .scope = OPTIONS_TABLE_SESSION,
+	  .minimum = 0,
+	  .maximum = INT_MAX,
+	  .default_num = 0,
+	  .unit = "lines",
+	  .text = "Number of lines of history after which older lines are "
+		  "moved to a file. "
+		  "Zero means history is kept in memory."
+	},
+
 	{ .name = "initial-repeat-time",
 	  .type = OPTIONS_TABLE_NUMBER,
 	  .scope = OPTIONS_TABLE_SESSION,
@@ -1162,9 +1196,8 @@ const struct options_table_entry options_table[] = {
 	  .default_str = "#[align=right]"
 			 "#{t/p:top_line_time}#{?#{e|>:#{top_line_time},0}, ,}"
 			 "[#{scroll_position}/#{history_size}]"
-			 "#{?search_timed_out, (timed out),"
 			 "#{?search_count, (#{search_count}"
-			 "#{?search_count_partial,+,} results),}}",
+			 "#{?search_count_partial,+,} results),}",
 	  .text = "Format of the position indicator in copy mode."
 	},
 
@@ -416,6 +416,10 @@ popup_make_pane(struct popup_data *pd, enum layout_type type)
 		return;
 	hlimit = options_get_number(s->options, "history-limit");
 	new_wp = window_add_pane(wp->window, NULL, hlimit, 0);
+	new_wp->base.grid->hcompress = options_get_number(s->options,
+	    "history-compress");
+	new_wp->base.grid->hspill = options_get_number(s->options,
+	    "history-spill");
 	layout_assign_pane(lc, new_wp, 0);
 
 	if (pd->job != NULL) {
@@ -384,3 +384,9 @@ proc_get_peer_uid(struct tmuxpeer *peer)
 {
 	return (peer->uid);
 }
+
+u_int
+proc_get_peer_queued(struct tmuxpeer *peer)
+{
+	return (imsgbuf_queuelen(&peer->ibuf));
+}
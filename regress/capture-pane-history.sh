@@ -0,0 +1,38 @@
+#!/bin/sh
+
+# capture-pane should capture a large history in full, to stdout or a buffer,
+# while the pane carries on writing
+
+PATH=/bin:/usr/bin
+TERM=screen
+
+[ -z "$TEST_TMUX" ] && TEST_TMUX=$(readlink -f ../tmux)
+TMUX="$TEST_TMUX -Ltest"
+$TMUX kill-server 2>/dev/null
+
+TMP1=$(mktemp)
+TMP2=$(mktemp)
+TMP3=$(mktemp)
+trap "rm -f $TMP1 $TMP2 $TMP3" 0 1 15
+
+CMD="awk 'BEGIN { for (i = 0; i < 100000; i++) printf \"line %d \\033[3%dm%s\\033[m\\n\", i, i % 8, (i % 1000 == 0) ? \"needle\" : \"hay\" }'"
+
+$TMUX -f/dev/null new -d -x80 -y24 \; set -g history-limit 150000 || exit 1
+$TMUX neww -d "$CMD; $TMUX wait -S done; while :; do echo more; sleep 0.01; done" \; \
+	wait done || exit 1
+awk 'BEGIN { for (i = 0; i < 100000; i++) printf "line %d %s\n", i, (i % 1000 == 0) ? "needle" : "hay" }' >$TMP3
+
+$TMUX capturep -t:1 -pS- >$TMP1 || exit 1
+head -100000 $TMP1 | cmp -s - $TMP3 || exit 1
+[ $(grep -c '^line ' $TMP1) -eq 100000 ] || exit 1
+
+$TMUX capturep -t:1 -S- -b capture \; saveb -b capture $TMP2 || exit 1
+head -100000 $TMP2 | cmp -s - $TMP3 || exit 1
+[ $(grep -c '^line ' $TMP2) -eq 100000 ] || exit 1
+
+$TMUX capturep -t:1 -epS- | grep '^line 9999[89] ' >$TMP1 || exit 1
+printf 'line 99998 \033[36mhay\033[39m\nline 99999 \033[37mhay\033[39m\n' | \
+	cmp -s - $TMP1 || exit 1
+$TMUX kill-server 2>/dev/null
+
+exit 0
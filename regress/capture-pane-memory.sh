@@ -0,0 +1,38 @@
+#!/bin/sh
+
+# capture-pane should not expand compressed or spilled history in the server
+# while capturing it
+
+PATH=/bin:/usr/bin
+TERM=screen
+
+[ -z "$TEST_TMUX" ] && TEST_TMUX=$(readlink -f ../tmux)
+TMUX="$TEST_TMUX -Ltest"
+$TMUX kill-server 2>/dev/null
+
+CMD="awk 'BEGIN { for (i = 0; i < 200000; i++) printf \"line %d \\033[3%dm%-60s\\033[m\\n\", i, i % 8, (i % 1000 == 0) ? \"needle\" : \"hay\" }'"
+
+$TMUX -f/dev/null new -d -x80 -y24 \; set -g history-limit 250000 || exit 1
+
+# Only Linux can reset and report the peak memory of the server.
+pid=$($TMUX display -p '#{pid}')
+if ! echo 5 2>/dev/null >/proc/$pid/clear_refs; then
+	$TMUX kill-server 2>/dev/null
+	exit 0
+fi
+
+for option in history-compress history-spill; do
+	$TMUX set -g $option 1000 \; \
+		neww -dn$option "$CMD; $TMUX wait -S done; sleep 30" \; \
+		wait done \; set -gu $option || exit 1
+
+	echo 5 >/proc/$pid/clear_refs
+	before=$(awk '/^VmHWM:/ { print $2 }' /proc/$pid/status)
+	[ $($TMUX capturep -t:$option -pS- | grep -c '^line ') -eq 200000 ] || \
+		exit 1
+	after=$(awk '/^VmHWM:/ { print $2 }' /proc/$pid/status)
+	[ $((after - before)) -lt 32768 ] || exit 1
+done
+$TMUX kill-server 2>/dev/null
+
+exit 0
@@ -0,0 +1,49 @@
+#!/bin/sh
+
+# cells with colours, attributes and hyperlinks should keep them through reflow
+# and in other panes when one pane's history is cleared or the pane is closed
+
+PATH=/bin:/usr/bin
+TERM=screen
+
+[ -z "$TEST_TMUX" ] && TEST_TMUX=$(readlink -f ../tmux)
+TMUX="$TEST_TMUX -Ltest"
+$TMUX kill-server 2>/dev/null
+
+TMP1=$(mktemp)
+TMP2=$(mktemp)
+TMP3=$(mktemp)
+trap "rm -f $TMP1 $TMP2 $TMP3" 0 1 15
+
+CMD="awk 'BEGIN { for (i = 0; i < 2000; i++) { s = \"\"; for (j = 0; j < i % 60; j++) s = s \"x\"; printf \"\\033[38;2;%d;%d;%dm%d \\033[48;2;1;%d;3;4:3;58:2::9:8:%dm\\342\\202\\254 \\346\\227\\245 \\033]8;;http://x/%d\\033\\\\%s\\033]8;;\\033\\\\\\033[m end\\n\", i % 256, i % 7, i % 13, i, i % 50, i % 11, i % 5, s } }'"
+
+$TMUX -f/dev/null new -d -x80 -y24 \; set -g history-limit 5000 || exit 1
+$TMUX neww -d "$CMD; $TMUX wait -S one; sleep 30" \; wait one || exit 1
+$TMUX capture-pane -t:1 -epJS- >$TMP1 || exit 1
+[ $(grep -c ' end$' $TMP1) -eq 2000 ] || exit 1
+
+$TMUX resizew -t:1 -x40 \; resizew -t:1 -x80 || exit 1
+$TMUX capture-pane -t:1 -epJS- >$TMP2 || exit 1
+cmp -s $TMP1 $TMP2 || exit 1
+
+# Copy mode does not have the hyperlinks, so leave them out.
+E=$(printf '\033')
+sed "s/$E]8;;[^$E]*$E\\\\//g" $TMP1 >$TMP3
+$TMUX copy-mode -t:1 \; capture-pane -t:1 -MepJS- >$TMP2 || exit 1
+cmp -s $TMP2 $TMP3 || exit 1
+$TMUX send -t:1 -X cancel || exit 1
+
+$TMUX neww -d "$CMD; $TMUX wait -S two; sleep 30" \; wait two || exit 1
+$TMUX capture-pane -t:2 -epJS- >$TMP2 || exit 1
+cmp -s $TMP1 $TMP2 || exit 1
+$TMUX clear-history -t:2 \; kill-window -t:2 || exit 1
+$TMUX capture-pane -t:1 -epJS- >$TMP2 || exit 1
+cmp -s $TMP1 $TMP2 || exit 1
+
+$TMUX clear-history -t:1 || exit 1
+$TMUX neww -d "$CMD; $TMUX wait -S three; sleep 30" \; wait three || exit 1
+$TMUX capture-pane -t:2 -epJS- >$TMP2 || exit 1
+cmp -s $TMP1 $TMP2 || exit 1
+$TMUX kill-server 2>/dev/null
+
+exit 0
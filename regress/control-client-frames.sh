@@ -0,0 +1,31 @@
+#!/bin/sh
+
+# with the frames flag, control mode output should be sent as binary frames
+# and pane output should not be escaped
+
+PATH=/bin:/usr/bin
+TERM=screen
+
+[ -z "$TEST_TMUX" ] && TEST_TMUX=$(readlink -f ../tmux)
+TMUX="$TEST_TMUX -Ltest"
+$TMUX kill-server 2>/dev/null
+
+TMP=$(mktemp)
+OUT=$(mktemp)
+trap "rm -f $TMP $OUT" 0 1 15
+
+$TMUX -f/dev/null new -d "sleep 2; printf 'a\\\\b\\001'; sleep 2" || exit 1
+sleep 1
+(sleep 3; echo detach) | $TMUX -C a -f frames >$TMP
+od -An -v -tx1 $TMP|tr -d '\n' >$OUT
+
+# Output frame for %0 with length 4 and the raw bytes.
+grep -q ' 02 00 00 00 00\( [0-9a-f][0-9a-f]\)\{8\} 00 00 00 04 61 5c 62 01' \
+    $OUT || exit 1
+# Line frame for %exit, with no pane and no age.
+grep -q ' 01 ff ff ff ff\( 00\)\{8\} 00 00 00 05 25 65 78 69 74$' \
+    $OUT || exit 1
+grep -q '%output' $TMP && exit 1
+$TMUX kill-server 2>/dev/null
+
+exit 0
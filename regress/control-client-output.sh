@@ -0,0 +1,24 @@
+#!/bin/sh
+
+# %output in control mode should escape bytes less than space and backslash as
+# octal and pass everything else through unchanged
+
+PATH=/bin:/usr/bin
+TERM=screen
+
+[ -z "$TEST_TMUX" ] && TEST_TMUX=$(readlink -f ../tmux)
+TMUX="$TEST_TMUX -Ltest"
+$TMUX kill-server 2>/dev/null
+
+TMP=$(mktemp)
+OUT=$(mktemp)
+trap "rm -f $TMP $OUT" 0 1 15
+
+$TMUX -f/dev/null new -d "sleep 2; printf 'a\\\\b\\tc\\001\\033[m\\303\\251~'; sleep 2" || exit 1
+sleep 1
+(sleep 3; echo detach) | $TMUX -C a >$TMP
+grep ^%output $TMP >$OUT
+printf '%%output %%0 a\\134b\\011c\\001\\033[m\303\251~\n'|cmp -s $OUT - || exit 1
+$TMUX kill-server 2>/dev/null
+
+exit 0
@@ -0,0 +1,41 @@
+#!/bin/sh
+
+# copy mode should keep the history as it was when entered while the pane
+# carries on writing, whether the history is in memory, packed or spilled
+
+PATH=/bin:/usr/bin
+TERM=screen
+
+[ -z "$TEST_TMUX" ] && TEST_TMUX=$(readlink -f ../tmux)
+TMUX="$TEST_TMUX -Ltest"
+$TMUX kill-server 2>/dev/null
+
+TMP1=$(mktemp)
+TMP2=$(mktemp)
+TMP3=$(mktemp)
+trap "rm -f $TMP1 $TMP2 $TMP3" 0 1 15
+
+CMD1="awk 'BEGIN { for (i = 0; i < 3000; i++) { s = \"\"; for (j = 0; j < i % 100; j++) s = s \"x\"; printf \"\\033[3%dm%d\\033[m \\342\\202\\254 %s\\n\", i % 8, i, s } }'"
+CMD2="awk 'BEGIN { for (i = 0; i < 2000; i++) printf \"more %d\\n\", i }'"
+CMD="$CMD1; $TMUX wait -S one; $TMUX wait two; $CMD2; $TMUX wait -S three; sleep 10"
+
+$TMUX -f/dev/null new -d -x80 -y24 \; set -g history-limit 3500 \; \
+	set -g history-compress 300 \; set -g history-spill 1000 || exit 1
+$TMUX neww -d "$CMD" \; wait one || exit 1
+$TMUX capture-pane -t:1 -epJS- >$TMP1 || exit 1
+$TMUX copy-mode -t:1 || exit 1
+$TMUX capture-pane -t:1 -MepJS- >$TMP2 || exit 1
+cmp -s $TMP1 $TMP2 || exit 1
+
+$TMUX wait -S two \; wait three || exit 1
+$TMUX resizew -t:1 -x40 \; resizew -t:1 -x80 || exit 1
+$TMUX capture-pane -t:1 -MepJS- >$TMP2 || exit 1
+cmp -s $TMP1 $TMP2 || exit 1
+
+$TMUX capture-pane -t:1 -epJS- >$TMP1 || exit 1
+$TMUX send -t:1 -X cancel \; copy-mode -t:1 || exit 1
+$TMUX capture-pane -t:1 -MepJS- >$TMP3 || exit 1
+cmp -s $TMP1 $TMP3 || exit 1
+$TMUX kill-server 2>/dev/null
+
+exit 0
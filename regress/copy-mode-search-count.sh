@@ -0,0 +1,33 @@
+#!/bin/sh
+
+# search in copy mode should mark the visible matches straight away and then
+# count every match in a large history without giving up
+
+PATH=/bin:/usr/bin
+TERM=screen
+
+[ -z "$TEST_TMUX" ] && TEST_TMUX=$(readlink -f ../tmux)
+TMUX="$TEST_TMUX -Ltest"
+$TMUX kill-server 2>/dev/null
+
+CMD="awk 'BEGIN { for (i = 0; i < 200000; i++) printf \"line %d %s\\n\", i, (i % 1000 == 0) ? \"needle\" : \"hay\" }'"
+
+$TMUX -f/dev/null new -d -x80 -y24 \; set -g history-limit 250000 \; \
+	setw -g mode-keys vi || exit 1
+$TMUX neww -d "$CMD; $TMUX wait -S done; sleep 30" \; wait done || exit 1
+$TMUX copy-mode -t:1 \; send -t:1 -X search-backward needle || exit 1
+[ "$($TMUX display -pt:1 '#{search_match}')" = "needle" ] || exit 1
+
+n=0
+while [ "$($TMUX display -pt:1 '#{search_count_partial}')" = 1 ]; do
+	n=$((n + 1))
+	[ $n -lt 300 ] || exit 1
+	sleep 0.1
+done
+[ "$($TMUX display -pt:1 '#{search_count}')" = 200 ] || exit 1
+
+$TMUX send -t:1 -X history-top \; send -t:1 -X search-again || exit 1
+[ "$($TMUX display -pt:1 '#{search_match}')" = "needle" ] || exit 1
+$TMUX kill-server 2>/dev/null
+
+exit 0
@@ -0,0 +1,50 @@
+#!/bin/sh
+
+# regular expression search in copy mode should find matches anywhere in long
+# wrapped lines, both forwards and backwards, and anchor ^ and $ to the start
+# and end of the whole line rather than of each row
+
+PATH=/bin:/usr/bin
+TERM=screen
+
+[ -z "$TEST_TMUX" ] && TEST_TMUX=$(readlink -f ../tmux)
+TMUX="$TEST_TMUX -Ltest"
+$TMUX kill-server 2>/dev/null
+
+CMD="awk 'BEGIN { s = \"\"; for (i = 0; i < 5000; i++) s = s \"x\"; t = \"\"; for (i = 0; i < 300; i++) t = t \"ab\"; print \"first\"; print \"start\" s \"end\"; print \"middle\"; print t; print \"last\" }'"
+
+MATCH=$(awk 'BEGIN { s = ""; for (i = 0; i < 5000; i++) s = s "x"; print "start" s "end" }')
+XS=$(echo "$MATCH" | sed 's/^start//; s/d$//')
+
+check()
+{
+	$TMUX send -t:1 -X history-top \; send -t:1 -X "$1" "$2" || exit 1
+	n=0
+	while [ "$($TMUX display -pt:1 '#{search_count_partial}')" = 1 ]; do
+		n=$((n + 1))
+		[ $n -lt 100 ] || exit 1
+		sleep 0.1
+	done
+	[ "$($TMUX display -pt:1 '#{search_match}')" = "$3" ] || exit 1
+	[ -z "$4" ] || [ "$($TMUX display -pt:1 '#{search_count}')" = "$4" ] || \
+		exit 1
+}
+
+$TMUX -f/dev/null new -d -x80 -y24 \; set -g history-limit 1000 \; \
+	setw -g mode-keys vi || exit 1
+$TMUX neww -d "$CMD; $TMUX wait -S done; sleep 30" \; wait done || exit 1
+$TMUX copy-mode -t:1 || exit 1
+
+check search-forward 'startx*end' "$MATCH" 1
+check search-forward 'xend$' xend 1
+check search-forward '(ab)+$' "$(printf %300s | sed 's/ /ab/g')" 1
+check search-forward 'ab' ab 300
+check search-forward '^x' ''
+
+$TMUX send -t:1 -X history-bottom \; send -t:1 -X search-backward 'x+en' || \
+	exit 1
+[ "$($TMUX display -pt:1 '#{search_match}')" = "$XS" ] || exit 1
+[ "$($TMUX display -pt:1 '#{copy_cursor_x}')" = 5 ] || exit 1
+$TMUX kill-server 2>/dev/null
+
+exit 0
@@ -0,0 +1,32 @@
+#!/bin/sh
+
+# plain text search in copy mode should find tabs and characters written over
+# cells with other colours, including the padding of wide characters
+
+PATH=/bin:/usr/bin
+TERM=screen
+
+[ -z "$TEST_TMUX" ] && TEST_TMUX=$(readlink -f ../tmux)
+TMUX="$TEST_TMUX -Ltest"
+$TMUX kill-server 2>/dev/null
+
+CMD="printf '\\033[48;2;1;2;3m        \\033[mq\\r\\tx\\n\\033[48;2;1;2;3m\\346\\227\\245\\033[m\\rab\\346\\234\\254y\\n'"
+
+check()
+{
+	$TMUX send -t:1 -X history-bottom \; \
+		send -t:1 -X search-backward-text "$1" || exit 1
+	[ "$($TMUX display -pt:1 '#{search_match}')" = "$1" ] || exit 1
+	[ "$($TMUX display -pt:1 '#{copy_cursor_x}')" = 0 ] || exit 1
+	[ "$($TMUX display -pt:1 '#{copy_cursor_y}')" = "$2" ] || exit 1
+}
+
+$TMUX -f/dev/null new -d -x80 -y24 \; setw -g mode-keys vi || exit 1
+$TMUX neww -d "$CMD; $TMUX wait -S done; sleep 30" \; wait done || exit 1
+$TMUX copy-mode -t:1 || exit 1
+
+check "$(printf '\tx')" 0
+check "$(printf 'ab\346\234\254y')" 1
+$TMUX kill-server 2>/dev/null
+
+exit 0
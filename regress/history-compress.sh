@@ -0,0 +1,38 @@
+#!/bin/sh
+
+# compressed history should capture the same as uncompressed history
+
+PATH=/bin:/usr/bin
+TERM=screen
+
+[ -z "$TEST_TMUX" ] && TEST_TMUX=$(readlink -f ../tmux)
+TMUX="$TEST_TMUX -Ltest"
+$TMUX kill-server 2>/dev/null
+
+TMP1=$(mktemp)
+TMP2=$(mktemp)
+trap "rm -f $TMP1 $TMP2" 0 1 15
+
+CMD="awk 'BEGIN { for (i = 0; i < 2000; i++) { s = \"\"; for (j = 0; j < i % 300; j++) s = s \"x\"; printf \"\\033[3%dm%d\\033[m \\342\\202\\254 %s\\n\", i % 8, i, s } }'; sleep 10"
+
+# Only the test session has history-compress so the reference pane keeps its
+# history in memory.
+$TMUX -f/dev/null new -d -sref -x80 -y24 \; set -g history-limit 50000 \; \
+	neww -d -tref:1 "$CMD" || exit 1
+$TMUX new -d -stest -x80 -y24 \; set -ttest history-compress 100 \; \
+	neww -d -ttest:1 "$CMD" || exit 1
+sleep 2
+[ "$($TMUX display -ptref:1 '#{history-compress}')" = 0 ] || exit 1
+
+# The test pane should be using much less memory than the reference pane.
+REF=$($TMUX display -ptref:1 '#{history_bytes}')
+TEST=$($TMUX display -pttest:1 '#{history_bytes}')
+[ $((TEST * 2)) -lt $REF ] || exit 1
+
+$TMUX capture-pane -tref:1 -epJS- >$TMP1 || exit 1
+$TMUX resizew -ttest:1 -x40 \; resizew -ttest:1 -x80 || exit 1
+$TMUX capture-pane -ttest:1 -epJS- >$TMP2 || exit 1
+cmp -s $TMP1 $TMP2 || exit 1
+$TMUX kill-server 2>/dev/null
+
+exit 0
@@ -0,0 +1,39 @@
+#!/bin/sh
+
+# history spilled to a file should capture the same as history in memory
+
+PATH=/bin:/usr/bin
+TERM=screen
+
+[ -z "$TEST_TMUX" ] && TEST_TMUX=$(readlink -f ../tmux)
+TMUX="$TEST_TMUX -Ltest"
+$TMUX kill-server 2>/dev/null
+
+TMP1=$(mktemp)
+TMP2=$(mktemp)
+trap "rm -f $TMP1 $TMP2" 0 1 15
+
+CMD="awk 'BEGIN { for (i = 0; i < 2000; i++) { s = \"\"; for (j = 0; j < i % 300; j++) s = s \"x\"; printf \"\\033[3%dm%d\\033[m \\342\\202\\254 %s\\n\", i % 8, i, s } }'; sleep 10"
+
+# Only the test session has history-spill so the reference pane keeps its
+# history in memory.
+$TMUX -f/dev/null new -d -sref -x80 -y24 \; set -g history-limit 50000 \; \
+	neww -d -tref:1 "$CMD" || exit 1
+$TMUX new -d -stest -x80 -y24 \; set -ttest history-spill 200 \; \
+	neww -d -ttest:1 "$CMD" || exit 1
+sleep 2
+[ "$($TMUX display -ptref:1 '#{history-spill}')" = 0 ] || exit 1
+
+# Spilled history is not counted, so the test pane should be using much less
+# memory than the reference pane (and less than compressed history would).
+REF=$($TMUX display -ptref:1 '#{history_bytes}')
+TEST=$($TMUX display -pttest:1 '#{history_bytes}')
+[ $((TEST * 10)) -lt $REF ] || exit 1
+
+$TMUX capture-pane -tref:1 -epJS- >$TMP1 || exit 1
+$TMUX resizew -ttest:1 -x40 \; resizew -ttest:1 -x80 || exit 1
+$TMUX capture-pane -ttest:1 -epJS- >$TMP2 || exit 1
+cmp -s $TMP1 $TMP2 || exit 1
+$TMUX kill-server 2>/dev/null
+
+exit 0
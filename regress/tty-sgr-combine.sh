@@ -0,0 +1,63 @@
+#!/bin/sh
+
+# a tmux client should combine the SGR sequences for a cell into as few as it
+# can without putting more than 16 parameters in any of them, and the terminal
+# should end up with the same attributes as the pane
+
+PATH=/bin:/usr/bin
+TERM=screen
+
+[ -z "$TEST_TMUX" ] && TEST_TMUX=$(readlink -f ../tmux)
+TMUX="$TEST_TMUX -Ltest"
+$TMUX kill-server 2>/dev/null
+TMUX2="$TEST_TMUX -Ltest2"
+$TMUX2 kill-server 2>/dev/null
+
+TMP1=$(mktemp)
+TMP2=$(mktemp)
+OUT=$(mktemp)
+FIFO=$(mktemp -u)
+trap "rm -f $TMP1 $TMP2 $OUT $FIFO; $TMUX kill-server 2>/dev/null; $TMUX2 kill-server 2>/dev/null" 0 1 15
+mkfifo $FIFO || exit 1
+
+# The outer tmux is the terminal for a client of the inner tmux and everything
+# the client writes is piped to a file.
+$TMUX2 -f/dev/null new -d -x80 -y24 "while :; do cat $FIFO; done" \; \
+	set -g status off \; \
+	set -as terminal-features '*:RGB:overline:strikethrough:usstyle' || \
+	exit 1
+$TMUX -f/dev/null new -d -x80 -y24 \; set -g default-terminal tmux-256color \; \
+	respawnp -k "$TMUX2 attach" \; pipep -O "cat >$OUT" || exit 1
+sleep 1
+
+printf '\033[1;2;3;4;5;7;9;53m\033[38;2;1;2;3m\033[48;2;4;5;6m' >$FIFO
+printf '\033[58;2;7;8;9mx\033[mA\033[4:3;1;38;5;200;48;5;100mz\033[m\n' >$FIFO
+printf '\033[1;31;42mbold\033[m \033[4;38;2;10;20;30mrgb\033[m\n' >$FIFO
+
+n=0
+while :; do
+	$TMUX capturep -ep >$TMP1 || exit 1
+	$TMUX2 capturep -ep >$TMP2 || exit 1
+	cmp -s $TMP1 $TMP2 && break
+	n=$((n + 1))
+	[ $n -lt 20 ] || exit 1
+	sleep 0.1
+done
+
+# Red and green should have gone out in the same sequence as any attribute
+# changes.
+E=$(printf '\033')
+grep -Eq "$E\[([0-9]+;)*31;42(;[0-9]+)*mbold" $OUT || exit 1
+grep -q "m$E\[[0-9;]*mbold" $OUT && exit 1
+
+# No sequence should have more than 16 parameters.
+awk '{
+	while (match($0, /\033\[[0-9;:]*m/)) {
+		s = substr($0, RSTART + 2, RLENGTH - 3)
+		if (gsub(/[;:]/, "", s) >= 16)
+			exit 1
+		$0 = substr($0, RSTART + RLENGTH)
+	}
+}' $OUT || exit 1
+
+exit 0
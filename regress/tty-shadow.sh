@@ -0,0 +1,103 @@
+#!/bin/sh
+
+# a tmux client should leave its terminal showing exactly what is in the pane
+# after scrolls, clears, cursor motion, popups, zoom and window changes, even
+# though it skips cells the terminal already shows
+
+PATH=/bin:/usr/bin
+TERM=screen
+
+[ -z "$TEST_TMUX" ] && TEST_TMUX=$(readlink -f ../tmux)
+TMUX="$TEST_TMUX -Ltest"
+$TMUX kill-server 2>/dev/null
+TMUX2="$TEST_TMUX -Ltest2"
+$TMUX2 kill-server 2>/dev/null
+
+TMP1=$(mktemp)
+TMP2=$(mktemp)
+FIFO=$(mktemp -u)
+trap "rm -f $TMP1 $TMP2 $FIFO; $TMUX kill-server 2>/dev/null; $TMUX2 kill-server 2>/dev/null" 0 1 15
+mkfifo $FIFO || exit 1
+
+# The outer tmux is the terminal for a client of the inner tmux, so its pane
+# should match the active pane of the inner tmux once the client has drawn it.
+check()
+{
+	n=0
+	while :; do
+		$TMUX capturep -ep >$TMP1 || exit 1
+		$TMUX2 capturep -ep >$TMP2 || exit 1
+		cmp -s $TMP1 $TMP2 && break
+		n=$((n + 1))
+		[ $n -lt 20 ] || exit 1
+		sleep 0.1
+	done
+}
+
+# Write a dot in every fourth column of each line. The client may move the
+# cursor between them by writing the cells it believes are already there, so
+# any cells it has wrong become visible.
+probe()
+{
+	awk 'BEGIN { for (y = 1; y <= 24; y++) for (x = 1; x <= 80; x += 4) printf "\033[%d;%dH.", y, x }' >$FIFO
+}
+
+# Fill the screen so that clearing changes every cell it touches.
+FILL="awk 'BEGIN { for (y = 1; y <= 24; y++) { printf \"\\033[%d;1H\", y; for (x = 1; x <= 80; x++) printf \"%c\", 64 + (x + y) % 26 } }'"
+fill()
+{
+	eval "$FILL" >$FIFO
+}
+
+$TMUX2 -f/dev/null new -d -x80 -y24 "while :; do cat $FIFO; done" \; \
+	set -g status off || exit 1
+$TMUX -f/dev/null new -d -x80 -y24 "$TMUX2 attach" || exit 1
+sleep 1
+check
+
+awk 'BEGIN { for (i = 0; i < 40; i++) printf "\033[3%dm%d line\033[m %d\n", i % 8, i, i }' >$FIFO
+probe
+check
+
+printf '\033[5;15r\033[15H' >$FIFO
+awk 'BEGIN { for (i = 0; i < 10; i++) printf "\033[4%dmregion %d\033[m\n", i % 8, i }' >$FIFO
+printf '\033[5H\033M\033M\033[8H\033[2M\033[3L\033[r' >$FIFO
+probe
+check
+
+printf '\033[44m\033[10;20H\033[K\033[12;1H\033[1K\033[14H\033[2K' >$FIFO
+printf '\033[18;30H\033[J\033[3;10H\033[1J\033[m' >$FIFO
+probe
+check
+
+fill
+printf '\033[11;20H\033[K\033[13;20H\033[1K\033[15H\033[2K' >$FIFO
+printf '\033[19;30H\033[J\033[2;10H\033[1J\033[21;5H\033[5X' >$FIFO
+probe
+check
+
+printf '\033[2;5Hab\033[20;70H\033[1mcd\033[m\033[6;1H\033[5@' >$FIFO
+printf '\033[7;3H\033[3P\033[9;9H\033[4X\033[Hx\033[24;79Hyz' >$FIFO
+probe
+check
+
+fill
+$TMUX2 popup -c"$($TMUX2 lsc -F'#{client_name}')" -w40 -h10 -E 'sleep 1' || \
+	exit 1
+sleep 2
+check
+
+$TMUX2 splitw -h 'printf "\033[32mright\033[m"; sleep 30' \; \
+	selectp -t:0.0 \; resizep -Z || exit 1
+check
+$TMUX2 resizep -Z \; resizep -Z || exit 1
+check
+
+# The same text with other attributes must still be drawn.
+fill
+$TMUX2 neww "printf '\033[1;31m'; $FILL; sleep 30" || exit 1
+check
+$TMUX2 selectw -t:0 || exit 1
+check
+
+exit 0
@@ -461,4 +461,5 @@ recalculate_sizes_now(int now)
 	/* Walk each window and adjust the size. */
 	RB_FOREACH(w, windows, &windows)
 		recalculate_size(w, now);
+	window_update_observers();
 }
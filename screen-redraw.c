@@ -694,6 +694,8 @@ screen_redraw_pane(struct client *c, struct window_pane *wp,
 		return;
 
 	screen_redraw_set_context(c, &ctx);
+	if ((c->tty.flags & TTY_DIRTY) && (~wp->flags & PANE_REDRAW))
+		ctx.dirty = c->tty.dirty;
 	tty_sync_start(&c->tty);
 	tty_update_mode(&c->tty, c->tty.mode, NULL);
 
@@ -861,15 +863,19 @@ screen_redraw_draw_borders_cell(struct screen_redraw_ctx *ctx, u_int i, u_int j)
 	else
 		isolates = 0;
 
+	screen_redraw_draw_border_arrows(ctx, i, j, cell_type, wp, active, &gc);
+
+	/* Nothing to do if the terminal is already showing this cell. */
 	if (ctx->statustop)
-		tty_cursor(tty, i, ctx->statuslines + j);
-	else
-		tty_cursor(tty, i, j);
+		j += ctx->statuslines;
+	if (!isolates &&
+	    tty_shadow_check(tty, i, j, &gc, &grid_default_cell, NULL))
+		return;
+
+	tty_cursor(tty, i, j);
 	if (isolates)
 		tty_puts(tty, END_ISOLATE);
 
-	screen_redraw_draw_border_arrows(ctx, i, j, cell_type, wp, active, &gc);
-
 	tty_cell(tty, &gc, &grid_default_cell, NULL, NULL);
 	if (isolates)
 		tty_puts(tty, START_ISOLATE);
@@ -963,6 +969,9 @@ screen_redraw_draw_pane(struct screen_redraw_ctx *ctx, struct window_pane *wp)
 		if (wp->yoff + j < ctx->oy || wp->yoff + j >= ctx->oy + ctx->sy)
 			continue;
 		y = top + wp->yoff + j - ctx->oy;
+		if (ctx->dirty != NULL &&
+		    (y >= tty->dirty_size || !bit_test(ctx->dirty, y)))
+			continue;
 
 		if (wp->xoff >= ctx->ox &&
 		    wp->xoff + wp->sx <= ctx->ox + ctx->sx) {
@@ -1082,7 +1091,8 @@ screen_redraw_draw_scrollbar(struct screen_redraw_ctx *ctx,
 {
 	struct client		*c = ctx->c;
 	struct tty		*tty = &c->tty;
-	struct grid_cell	 gc, slgc, *gcp;
+	struct grid_cell	 gc, slgc;
+	const struct grid_cell	*gcp;
 	struct style		*sb_style = &wp->scrollbar_style;
 	u_int			 i, j, imax, jmax;
 	u_int			 sb_w = sb_style->width, sb_pad = sb_style->pad;
@@ -1117,21 +1127,20 @@ screen_redraw_draw_scrollbar(struct screen_redraw_ctx *ctx,
 			    py < yoff - oy - 1 ||
 			    py >= sy || py < 0)
 				continue;
-			tty_cursor(tty, px, py);
 			if ((sb_pos == PANE_SCROLLBARS_LEFT &&
 			    i >= sb_w && i < sb_w + sb_pad) ||
 			    (sb_pos == PANE_SCROLLBARS_RIGHT &&
-			     i < sb_pad)) {
-				tty_cell(tty, &grid_default_cell,
-				    &grid_default_cell, NULL, NULL);
-			} else {
-				if (j >= slider_y && j < slider_y + slider_h)
-					gcp = &slgc;
-				else
-					gcp = &gc;
-				tty_cell(tty, gcp, &grid_default_cell, NULL,
-				    NULL);
-			}
+			     i < sb_pad))
+				gcp = &grid_default_cell;
+			else if (j >= slider_y && j < slider_y + slider_h)
+				gcp = &slgc;
+			else
+				gcp = &gc;
+			if (tty_shadow_check(tty, px, py, gcp,
+			    &grid_default_cell, NULL))
+				continue;
+			tty_cursor(tty, px, py);
+			tty_cell(tty, gcp, &grid_default_cell, NULL, NULL);
 		}
 	}
 }
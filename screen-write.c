@@ -176,6 +176,13 @@ screen_write_initctx(struct screen_write_ctx *ctx, struct tty_ctx *ttyctx,
 {
 	struct screen	*s = ctx->s;
 
+	if (ctx->flags & SCREEN_WRITE_UNOBSERVED) {
+		ttyctx->redraw_cb = screen_write_redraw_cb;
+		ttyctx->set_client_cb = NULL;
+		ttyctx->arg = ctx->wp;
+		return;
+	}
+
 	memset(ttyctx, 0, sizeof *ttyctx);
 
 	ttyctx->s = s;
@@ -273,10 +280,19 @@ screen_write_start_pane(struct screen_write_ctx *ctx, struct window_pane *wp,
 	screen_write_init(ctx, s);
 	ctx->wp = wp;
 
+	/*
+	 * If no client can see the pane, only the screen needs to be updated,
+	 * so nothing needs to be collected or passed to the tty.
+	 */
+	if (!window_pane_observed(wp))
+		ctx->flags |= SCREEN_WRITE_UNOBSERVED;
+
 	if (log_get_level() != 0) {
-		log_debug("%s: size %ux%u, pane %%%u (at %u,%u)",
+		log_debug("%s: size %ux%u, pane %%%u (at %u,%u)%s",
 		    __func__, screen_size_x(ctx->s), screen_size_y(ctx->s),
-		    wp->id, wp->xoff, wp->yoff);
+		    wp->id, wp->xoff, wp->yoff,
+		    (ctx->flags & SCREEN_WRITE_UNOBSERVED) ? ", unobserved" :
+		    "");
 	}
 }
 
@@ -1789,6 +1805,9 @@ screen_write_collect_scroll(struct screen_write_ctx *ctx, u_int bg)
 	char				*saved;
 	struct screen_write_citem	*ci;
 
+	if (ctx->flags & SCREEN_WRITE_UNOBSERVED)
+		return;
+
 	log_debug("%s: at %u,%u (region %u-%u)", __func__, s->cx, s->cy,
 	    s->rupper, s->rlower);
 
@@ -1820,6 +1839,13 @@ screen_write_collect_flush(struct screen_write_ctx *ctx, int scroll_only,
 	u_int				 y, cx, cy, last, items = 0;
 	struct tty_ctx			 ttyctx;
 
+	if (ctx->flags & SCREEN_WRITE_UNOBSERVED) {
+		screen_write_collect_clear(ctx, 0, screen_size_y(s));
+		ctx->scrolled = 0;
+		ctx->bg = 8;
+		return;
+	}
+
 	if (s->mode & MODE_SYNC) {
 		for (y = 0; y < screen_size_y(s); y++) {
 			cl = &ctx->s->write_list[y];
@@ -1897,6 +1923,13 @@ screen_write_collect_insert(struct screen_write_ctx *ctx,
 	struct screen_write_cline	*cl = &s->write_list[s->cy];
 	struct screen_write_citem	*before;
 
+	/* Nothing will be drawn, so no need to keep the list in order. */
+	if (ctx->flags & SCREEN_WRITE_UNOBSERVED) {
+		TAILQ_INSERT_TAIL(&cl->items, ci, entry);
+		ctx->item = screen_write_get_citem();
+		return;
+	}
+
 	before = screen_write_collect_trim(ctx, s->cy, ci->x, ci->used,
 	    &ci->wrapped);
 	if (before == NULL)
@@ -2042,6 +2075,66 @@ screen_write_collect_add(struct screen_write_ctx *ctx,
 	ctx->s->write_list[s->cy].data[s->cx + ci->used++] = gc->data.data[0];
 }
 
+/*
+ * Collect a run of printable ASCII characters with the same attributes. This
+ * is the same as calling screen_write_collect_add for each, but copies as
+ * much as fits on the line at once.
+ */
+void
+screen_write_collect_ascii(struct screen_write_ctx *ctx,
+    const struct grid_cell *gc, const u_char *buf, size_t len)
+{
+	struct screen			*s = ctx->s;
+	struct screen_write_citem	*ci;
+	struct screen_write_cline	*cl;
+	struct grid_cell		 tmp_gc;
+	u_int				 sx = screen_size_x(s);
+	size_t				 n;
+
+	if ((gc->flags & GRID_FLAG_TAB) ||
+	    (gc->attr & GRID_ATTR_CHARSET) ||
+	    (~s->mode & MODE_WRAP) ||
+	    (s->mode & MODE_INSERT) ||
+	    s->sel != NULL) {
+		memcpy(&tmp_gc, gc, sizeof tmp_gc);
+		for (n = 0; n < len; n++) {
+			utf8_set(&tmp_gc.data, buf[n]);
+			screen_write_collect_add(ctx, &tmp_gc);
+		}
+		return;
+	}
+
+	while (len != 0) {
+		if (s->cx > sx - 1 || ctx->item->used > sx - 1 - s->cx)
+			screen_write_collect_end(ctx);
+		ci = ctx->item; /* may have changed */
+
+		if (s->cx > sx - 1) {
+			log_debug("%s: wrapped at %u,%u", __func__, s->cx,
+			    s->cy);
+			ci->wrapped = 1;
+			screen_write_linefeed(ctx, 1, 8);
+			screen_write_set_cursor(ctx, 0, -1);
+		}
+
+		if (ci->used == 0) {
+			memcpy(&ci->gc, gc, sizeof ci->gc);
+			utf8_set(&ci->gc.data, *buf);
+		}
+		cl = &s->write_list[s->cy];
+		if (cl->data == NULL)
+			cl->data = xmalloc(sx);
+
+		n = sx - s->cx - ci->used;
+		if (n > len)
+			n = len;
+		memcpy(cl->data + s->cx + ci->used, buf, n);
+		ci->used += n;
+		buf += n;
+		len -= n;
+	}
+}
+
 /* Write cell data. */
 void
 screen_write_cell(struct screen_write_ctx *ctx, const struct grid_cell *gc)
@@ -2390,6 +2483,12 @@ screen_write_rawstring(struct screen_write_ctx *ctx, u_char *str, u_int len,
 {
 	struct tty_ctx	ttyctx;
 
+	/* This may go to clients that cannot see the pane. */
+	if (allow_invisible_panes && (ctx->flags & SCREEN_WRITE_UNOBSERVED)) {
+		screen_write_collect_clear(ctx, 0, screen_size_y(ctx->s));
+		ctx->flags &= ~SCREEN_WRITE_UNOBSERVED;
+	}
+
 	screen_write_initctx(ctx, &ttyctx, 0);
 	ttyctx.ptr = str;
 	ttyctx.num = len;
@@ -422,6 +422,7 @@ screen_resize_y(struct screen *s, u_int sy, int eat_empty, u_int *cy)
 		if (gd->flags & GRID_HISTORY && available > 0) {
 			if (available > needed)
 				available = needed;
+			grid_unshare(gd, gd->hsize - available);
 			gd->hscrolled -= available;
 			gd->hsize -= available;
 		} else
@@ -794,7 +795,7 @@ screen_print(struct screen *s)
 			goto out;
 		last += n;
 
-		gl = &s->grid->linedata[y];
+		gl = grid_get_line(s->grid, y);
 		for (x = 0; x < gl->cellused; x++) {
 			gce = &gl->celldata[x];
 			if (gce->flags & GRID_FLAG_PADDING)
@@ -48,6 +48,7 @@ static void	server_client_check_pane_buffer(struct window_pane *);
 static void	server_client_check_window_resize(struct window *);
 static key_code	server_client_check_mouse(struct client *, struct key_event *);
 static void	server_client_repeat_timer(int, short, void *);
+static void	server_client_redraw_timer(int, short, void *);
 static void	server_client_click_timer(int, short, void *);
 static void	server_client_check_exit(struct client *);
 static void	server_client_check_redraw(struct client *);
@@ -331,6 +332,7 @@ server_client_create(int fd)
 
 	evtimer_set(&c->repeat_timer, server_client_repeat_timer, c);
 	evtimer_set(&c->click_timer, server_client_click_timer, c);
+	evtimer_set(&c->redraw_timer, server_client_redraw_timer, c);
 
 	c->click_wp = -1;
 
@@ -491,6 +493,7 @@ server_client_lost(struct client *c)
 
 	evtimer_del(&c->repeat_timer);
 	evtimer_del(&c->click_timer);
+	evtimer_del(&c->redraw_timer);
 
 	key_bindings_unref_table(c->keytable);
 
@@ -2714,6 +2717,7 @@ server_client_loop(void)
 		server_client_check_window_resize(w);
 
 	/* Check clients. */
+	format_memo_start();
 	TAILQ_FOREACH(c, &clients, entry) {
 		server_client_check_exit(c);
 		if (c->session != NULL) {
@@ -2722,6 +2726,7 @@ server_client_loop(void)
 			server_client_reset_state(c);
 		}
 	}
+	format_memo_end();
 
 	/*
 	 * Any windows will have been redrawn as part of clients, so clear
@@ -3134,12 +3139,61 @@ server_client_check_exit(struct client *c)
 	free(c->exit_message);
 }
 
-/* Redraw timer callback. */
+/*
+ * Redraw timer callback. Nothing to do here, the redraw happens when the
+ * server loop next checks the client.
+ */
 static void
-server_client_redraw_timer(__unused int fd, __unused short events,
-    __unused void *data)
+server_client_redraw_timer(__unused int fd, __unused short events, void *data)
 {
-	log_debug("redraw timer fired");
+	struct client	*c = data;
+
+	log_debug("%s: redraw timer fired", c->name);
+}
+
+/*
+ * Work out how long to wait before redrawing a client, in milliseconds. If
+ * there is output left from before, wait for about as long as the terminal
+ * has taken to consume that much in the past. Otherwise redraw straight away
+ * if there has been a key since the last redraw, or limit redraws to
+ * redraw-rate a second.
+ */
+static u_int
+server_client_redraw_delay(struct client *c, size_t left)
+{
+	struct timeval	tv;
+	u_int		rate, interval, elapsed;
+	uint64_t	delay;
+
+	if (left != 0) {
+		if (c->write_rate == 0)
+			return (1);
+		delay = ((uint64_t)left * 1000) / c->write_rate;
+		if (delay == 0)
+			return (1);
+		if (delay > 100)
+			return (100);
+		return (delay);
+	}
+
+	if (timercmp(&c->activity_time, &c->redraw_last, >))
+		return (0);
+	rate = options_get_number(global_options, "redraw-rate");
+	if (rate == 0)
+		return (0);
+	interval = 1000 / rate;
+
+	if (gettimeofday(&tv, NULL) != 0)
+		fatal("gettimeofday failed");
+	if (timercmp(&tv, &c->redraw_last, <))
+		return (0);
+	timersub(&tv, &c->redraw_last, &tv);
+	if (tv.tv_sec != 0)
+		return (0);
+	elapsed = tv.tv_usec / 1000;
+	if (elapsed >= interval)
+		return (0);
+	return (interval - elapsed);
 }
 
 /*
@@ -3175,10 +3229,8 @@ server_client_check_redraw(struct client *c)
 	int			 needed, tty_flags, mode = tty->mode;
 	uint64_t		 client_flags = 0;
 	int			 redraw_pane, redraw_scrollbar_only;
-	u_int			 bit = 0;
-	struct timeval		 tv = { .tv_usec = 1000 };
-	static struct event	 ev;
-	size_t			 left;
+	u_int			 bit = 0, delay = 0;
+	struct timeval		 tv;
 
 	if (c->flags & (CLIENT_CONTROL|CLIENT_SUSPENDED))
 		return;
@@ -3194,8 +3246,10 @@ server_client_check_redraw(struct client *c)
 
 	/*
 	 * If there is outstanding data, defer the redraw until it has been
-	 * consumed. We can just add a timer to get out of the event loop and
-	 * end up back here.
+	 * consumed, and do not redraw more often than the redraw rate unless
+	 * a key has been pressed. We can just add a timer to get out of the
+	 * event loop and end up back here; anything that needs redrawn in the
+	 * meantime is combined into one redraw.
 	 */
 	needed = 0;
 	if (c->flags & CLIENT_ALLREDRAWFLAGS)
@@ -3214,13 +3268,14 @@ server_client_check_redraw(struct client *c)
 			}
 		}
 	}
-	if (needed && (left = EVBUFFER_LENGTH(tty->out)) != 0) {
-		log_debug("%s: redraw deferred (%zu left)", c->name, left);
-		if (!evtimer_initialized(&ev))
-			evtimer_set(&ev, server_client_redraw_timer, NULL);
-		if (!evtimer_pending(&ev, NULL)) {
-			log_debug("redraw timer started");
-			evtimer_add(&ev, &tv);
+	if (needed)
+		delay = server_client_redraw_delay(c, tty_output_length(tty));
+	if (delay != 0) {
+		log_debug("%s: redraw deferred (%u ms)", c->name, delay);
+		if (!evtimer_pending(&c->redraw_timer, NULL)) {
+			tv.tv_sec = delay / 1000;
+			tv.tv_usec = (delay % 1000) * 1000L;
+			evtimer_add(&c->redraw_timer, &tv);
 		}
 
 		if (~c->flags & CLIENT_REDRAWWINDOW) {
@@ -3229,6 +3284,7 @@ server_client_check_redraw(struct client *c)
 					log_debug("%s: pane %%%u needs redraw",
 					    c->name, wp->id);
 					c->redraw_panes |= (1 << bit);
+					tty_dirty_pane(tty, wp);
 				} else if (wp->flags & PANE_REDRAWSCROLLBAR) {
 					log_debug("%s: pane %%%u scrollbar "
 					    "needs redraw", c->name, wp->id);
@@ -3291,6 +3347,7 @@ server_client_check_redraw(struct client *c)
 		c->redraw_scrollbars = 0;
 		c->flags &= ~(CLIENT_REDRAWPANES|CLIENT_REDRAWSCROLLBARS);
 	}
+	tty->flags &= ~TTY_DIRTY;
 
 	if (c->flags & CLIENT_ALLREDRAWFLAGS) {
 		if (options_get_number(s->options, "set-titles")) {
@@ -3313,8 +3370,12 @@ server_client_check_redraw(struct client *c)
 		 * was empty, so we can record how many bytes the redraw
 		 * generated.
 		 */
-		c->redraw = EVBUFFER_LENGTH(tty->out);
+		c->redraw = tty_output_length(tty);
 		log_debug("%s: redraw added %zu bytes", c->name, c->redraw);
+
+		c->redraw_size = c->redraw;
+		if (gettimeofday(&c->redraw_last, NULL) != 0)
+			fatal("gettimeofday failed");
 	}
 }
 
@@ -3785,6 +3846,8 @@ server_client_control_flags(struct client *c, const char *next)
 		return (CLIENT_CONTROL_NOOUTPUT);
 	if (strcmp(next, "wait-exit") == 0)
 		return (CLIENT_CONTROL_WAITEXIT);
+	if (strcmp(next, "frames") == 0)
+		return (CLIENT_CONTROL_FRAMES);
 	return (0);
 }
 
@@ -3853,6 +3916,8 @@ server_client_get_flags(struct client *c)
 		strlcat(s, "no-output,", sizeof s);
 	if (c->flags & CLIENT_CONTROL_WAITEXIT)
 		strlcat(s, "wait-exit,", sizeof s);
+	if (c->flags & CLIENT_CONTROL_FRAMES)
+		strlcat(s, "frames,", sizeof s);
 	if (c->flags & CLIENT_CONTROL_PAUSEAFTER) {
 		xsnprintf(tmp, sizeof tmp, "pause-after=%u,",
 		    c->pause_age / 1000);
@@ -492,6 +492,7 @@ session_set_current(struct session *s, struct winlink *wl)
 	winlink_stack_remove(&s->lastw, wl);
 	winlink_stack_push(&s->lastw, s->curw);
 	s->curw = wl;
+	window_update_observers();
 	if (options_get_number(global_options, "focus-events")) {
 		if (old != NULL)
 			window_update_focus(old->window);
@@ -774,9 +775,11 @@ session_update_history(struct session *s)
 	struct winlink		*wl;
 	struct window_pane	*wp;
 	struct grid		*gd;
-	u_int			 limit, osize;
+	u_int			 limit, compress, spill, osize;
 
 	limit = options_get_number(s->options, "history-limit");
+	compress = options_get_number(s->options, "history-compress");
+	spill = options_get_number(s->options, "history-spill");
 	RB_FOREACH(wl, winlinks, &s->windows) {
 		TAILQ_FOREACH(wp, &wl->window->panes, entry) {
 			gd = wp->base.grid;
@@ -784,6 +787,9 @@ session_update_history(struct session *s)
 			osize = gd->hsize;
 			gd->hlimit = limit;
 			grid_collect_history(gd, 1);
+			gd->hcompress = compress;
+			gd->hspill = spill;
+			grid_pack_history(gd);
 
 			if (gd->hsize != osize) {
 				log_debug("%s: %%%u %u -> %u", __func__, wp->id,
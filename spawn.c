@@ -279,6 +279,10 @@ spawn_pane(struct spawn_context *sc, char **cause)
 		else
 			layout_assign_pane(sc->lc, new_wp, 0);
 	}
+	new_wp->base.grid->hcompress = options_get_number(s->options,
+	    "history-compress");
+	new_wp->base.grid->hspill = options_get_number(s->options,
+	    "history-spill");
 
 	/*
 	 * Now we have a pane with nothing running in it ready for the new
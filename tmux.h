@@ -51,6 +51,8 @@ struct control_state;
 struct environ;
 struct format_job_tree;
 struct format_tree;
+struct grid_share;
+struct grid_spill;
 struct hyperlinks_uri;
 struct hyperlinks;
 struct input_ctx;
@@ -75,6 +77,8 @@ struct sixel_image;
 struct tty_ctx;
 struct tty_code;
 struct tty_key;
+struct tty_sgr;
+struct tty_shadow;
 struct tmuxpeer;
 struct tmuxproc;
 struct winlink;
@@ -748,6 +752,9 @@ struct colour_palette {
 #define GRID_FLAG_CLEARED 0x40
 #define GRID_FLAG_TAB 0x80
 
+/* Number of lines in each block of grid lines. */
+#define GRID_BLOCK_LINES 128
+
 /* Grid line flags. */
 #define GRID_LINE_WRAPPED 0x1
 #define GRID_LINE_EXTENDED 0x2
@@ -794,15 +801,13 @@ struct grid_cell {
 	u_int			link;
 };
 
-/* Grid extended cell entry. */
+/*
+ * Grid extended cell entry. The attributes and colours are shared between all
+ * cells with the same style and style is an index into a table of them.
+ */
 struct grid_extd_entry {
 	utf8_char		data;
-	u_short			attr;
-	u_char			flags;
-	int			fg;
-	int			bg;
-	int			us;
-	u_int			link;
+	u_int			style;
 } __packed;
 
 /* Grid cell entry. */
@@ -832,10 +837,28 @@ struct grid_line {
 	time_t			 time;
 };
 
+/*
+ * Block of grid lines. If not in use, the lines may be packed and the packed
+ * data may be spilled to a file. Blocks in the history may be shared with
+ * another grid, in which case the lines are read only.
+ */
+struct grid_block {
+	struct grid_line	*linedata;
+	struct grid_share	*share;
+
+	u_char			*packed;
+	size_t			 packedsize;
+	u_int			 packedfirst;
+
+	int			 spilled;
+	size_t			 spilloffset;
+};
+
 /* Entire grid of cells. */
 struct grid {
 	int			 flags;
 #define GRID_HISTORY 0x1 /* scroll lines into history */
+#define GRID_BORROWED 0x2 /* spill file belongs to another grid */
 
 	u_int			 sx;
 	u_int			 sy;
@@ -843,8 +866,13 @@ struct grid {
 	u_int			 hscrolled;
 	u_int			 hsize;
 	u_int			 hlimit;
+	u_int			 hcompress;
+	u_int			 hspill;
+	struct grid_spill	*spill;
 
-	struct grid_line	*linedata;
+	struct grid_block	*lineblocks;
+	u_int			 nlineblocks;
+	u_int			 lineoffset;
 };
 
 /* Virtual cursor in a grid. */
@@ -1003,6 +1031,7 @@ struct screen_write_ctx {
 
 	int				 flags;
 #define SCREEN_WRITE_SYNC 0x1
+#define SCREEN_WRITE_UNOBSERVED 0x2
 
 	screen_write_init_ctx_cb	 init_ctx_cb;
 	void				*arg;
@@ -1065,6 +1094,8 @@ struct screen_redraw_ctx {
 	u_int		 sy;
 	u_int		 ox;
 	u_int		 oy;
+
+	bitstr_t	*dirty;
 };
 
 /* Screen size. */
@@ -1317,6 +1348,8 @@ struct window {
 #define WINDOW_RESIZE 0x20
 #define WINDOW_ALERTFLAGS (WINDOW_BELL|WINDOW_ACTIVITY|WINDOW_SILENCE)
 
+	u_int			 observers;
+
 	int			 alerts_queued;
 	TAILQ_ENTRY(window)	 alerts_entry;
 
@@ -1562,6 +1595,7 @@ struct tty_term {
 #define TERM_RGBCOLOURS 0x10
 #define TERM_VT100LIKE 0x20
 #define TERM_SIXEL 0x40
+#define TERM_SGR 0x80
 	int		 flags;
 
 	LIST_ENTRY(tty_term) entry;
@@ -1608,14 +1642,20 @@ struct tty {
 	struct evbuffer	*in;
 	struct event	 event_out;
 	struct evbuffer	*out;
-	struct event	 timer;
+	char		*out_buf;
+	size_t		 out_len;
+	size_t		 out_space;
 	size_t		 discarded;
+	bitstr_t	*dirty;
+	u_int		 dirty_size;
 
 	struct termios	 tio;
 	struct visible_ranges r;
 
 	struct grid_cell cell;
 	struct grid_cell last_cell;
+	struct tty_shadow *shadow;
+	struct tty_sgr	*sgr;
 
 #define TTY_NOCURSOR 0x1
 #define TTY_FREEZE 0x2
@@ -1632,6 +1672,8 @@ struct tty {
 #define TTY_WINSIZEQUERY 0x1000
 #define TTY_WAITFG 0x2000
 #define TTY_WAITBG 0x4000
+#define TTY_SHADOWING 0x8000
+#define TTY_DIRTY 0x10000
 #define TTY_ALL_REQUEST_FLAGS \
 	(TTY_HAVEDA|TTY_HAVEDA2|TTY_HAVEXDA)
 	int		 flags;
@@ -1979,7 +2021,13 @@ struct client {
 
 	size_t			 written;
 	size_t			 discarded;
+	size_t			 sgr_saved;
+
 	size_t			 redraw;
+	size_t			 redraw_size;
+	struct timeval		 redraw_last;
+	size_t			 write_rate;
+	struct event		 redraw_timer;
 
 	struct event		 repeat_timer;
 
@@ -2034,6 +2082,7 @@ struct client {
 #define CLIENT_ASSUMEPASTING 0x2000000000ULL
 #define CLIENT_REDRAWSCROLLBARS 0x4000000000ULL
 #define CLIENT_NO_DETACH_ON_DESTROY 0x8000000000ULL
+#define CLIENT_CONTROL_FRAMES 0x10000000000ULL
 #define CLIENT_ALLREDRAWFLAGS		\
 	(CLIENT_REDRAWWINDOW|		\
 	 CLIENT_REDRAWSTATUS|		\
@@ -2138,6 +2187,16 @@ enum control_sub_type {
 	CONTROL_SUB_ALL_WINDOWS
 };
 
+/*
+ * Control mode frame, used instead of lines when the frames flag is set. Each
+ * frame is a header followed by a payload of the given length; all numbers
+ * are in network byte order.
+ */
+#define CONTROL_FRAME_HEADER 17 /* type (1), pane (4), age (8), length (4) */
+#define CONTROL_FRAME_LINE 1
+#define CONTROL_FRAME_OUTPUT 2
+#define CONTROL_FRAME_NOPANE 0xffffffffU
+
 /* Key binding and key table. */
 struct key_binding {
 	key_code		 key;
@@ -2303,6 +2362,7 @@ void	proc_flush_peer(struct tmuxpeer *);
 void	proc_toggle_log(struct tmuxproc *);
 pid_t	proc_fork_and_daemon(int *);
 uid_t	proc_get_peer_uid(struct tmuxpeer *);
+u_int	proc_get_peer_queued(struct tmuxpeer *);
 
 /* cfg.c */
 extern int cfg_finished;
@@ -2387,6 +2447,8 @@ void		 format_defaults_pane(struct format_tree *,
 void		 format_defaults_paste_buffer(struct format_tree *,
 		     struct paste_buffer *);
 void		 format_lost_client(struct client *);
+void		 format_memo_start(void);
+void		 format_memo_end(void);
 char		*format_grid_word(struct grid *, u_int, u_int);
 char		*format_grid_hyperlink(struct grid *, u_int, u_int,
 		     struct screen *);
@@ -2525,6 +2587,8 @@ int	tty_window_offset(struct tty *, u_int *, u_int *, u_int *, u_int *);
 void	tty_update_window_offset(struct window *);
 void	tty_update_client_offset(struct client *);
 void	tty_raw(struct tty *, const char *);
+size_t	tty_output_length(struct tty *);
+void	tty_dirty_pane(struct tty *, struct window_pane *);
 void	tty_attributes(struct tty *, const struct grid_cell *,
 	    const struct grid_cell *, struct colour_palette *,
 	    struct hyperlinks *);
@@ -2570,6 +2634,26 @@ struct visible_ranges *tty_check_overlay_range(struct tty *, u_int, u_int,
 void	tty_draw_line(struct tty *, struct screen *, u_int, u_int, u_int,
 	    u_int, u_int, const struct grid_cell *, struct colour_palette *);
 
+/* tty-shadow.c */
+void	tty_shadow_free(struct tty *);
+void	tty_shadow_reset(struct tty *);
+void	tty_shadow_forget(struct tty *, u_int, u_int, u_int);
+void	tty_shadow_forget_lines(struct tty *, u_int, u_int);
+int	tty_shadow_get(struct tty *, u_int, u_int, struct grid_cell *);
+void	tty_shadow_set(struct tty *, u_int, u_int, const struct grid_cell *);
+void	tty_shadow_cell(struct tty *, const struct grid_cell *,
+	    const struct grid_cell *, struct colour_palette *,
+	    struct grid_cell *);
+int	tty_shadow_same(struct tty *, u_int, u_int, const struct grid_cell *);
+int	tty_shadow_check(struct tty *, u_int, u_int, const struct grid_cell *,
+	    const struct grid_cell *, struct colour_palette *);
+void	tty_shadow_set_pen(struct tty *, const struct grid_cell *,
+	    const struct grid_cell *, struct colour_palette *);
+void	tty_shadow_clear_pen(struct tty *);
+int	tty_shadow_get_text(struct tty *, u_int, u_int, u_int, char *);
+void	tty_shadow_clear(struct tty *, u_int, u_int, u_int);
+void	tty_shadow_scroll(struct tty *, u_int, u_int, int);
+
 #ifdef ENABLE_SIXEL
 void	tty_draw_images(struct client *, struct window_pane *, struct screen *);
 #endif
@@ -3077,15 +3161,21 @@ void	 grid_destroy(struct grid *);
 int	 grid_compare(struct grid *, struct grid *);
 void	 grid_collect_history(struct grid *, int);
 void	 grid_remove_history(struct grid *, u_int );
+void	 grid_remove_top_history(struct grid *, u_int);
 void	 grid_scroll_history(struct grid *, u_int);
 void	 grid_scroll_history_region(struct grid *, u_int, u_int, u_int);
 void	 grid_clear_history(struct grid *);
 const struct grid_line *grid_peek_line(struct grid *, u_int);
+int	 grid_cell_flags(const struct grid_line *, u_int);
 void	 grid_get_cell(struct grid *, u_int, u_int, struct grid_cell *);
 void	 grid_set_cell(struct grid *, u_int, u_int, const struct grid_cell *);
 void	 grid_set_padding(struct grid *, u_int, u_int);
 void	 grid_set_cells(struct grid *, u_int, u_int, const struct grid_cell *,
 	     const char *, size_t);
+int	 grid_line_packed(struct grid *, u_int);
+void	 grid_unshare(struct grid *, u_int);
+size_t	 grid_packed_size(struct grid *);
+void	 grid_pack_history(struct grid *);
 struct grid_line *grid_get_line(struct grid *, u_int);
 void	 grid_adjust_lines(struct grid *, u_int);
 void	 grid_clear(struct grid *, u_int, u_int, u_int, u_int, u_int);
@@ -3096,6 +3186,7 @@ char	*grid_string_cells(struct grid *, u_int, u_int, u_int,
 	     struct grid_cell **, int, struct screen *);
 void	 grid_duplicate_lines(struct grid *, u_int, struct grid *, u_int,
 	     u_int);
+void	 grid_share_lines(struct grid *, struct grid *, u_int);
 void	 grid_reflow(struct grid *, u_int);
 void	 grid_wrap_position(struct grid *, u_int, u_int, u_int *, u_int *);
 void	 grid_unwrap_position(struct grid *, u_int *, u_int *, u_int, u_int);
@@ -3208,6 +3299,8 @@ void	 screen_write_clearscreen(struct screen_write_ctx *, u_int);
 void	 screen_write_clearhistory(struct screen_write_ctx *);
 void	 screen_write_fullredraw(struct screen_write_ctx *);
 void	 screen_write_collect_end(struct screen_write_ctx *);
+void	 screen_write_collect_ascii(struct screen_write_ctx *,
+	     const struct grid_cell *, const u_char *, size_t);
 void	 screen_write_collect_add(struct screen_write_ctx *,
 	     const struct grid_cell *);
 void	 screen_write_cell(struct screen_write_ctx *, const struct grid_cell *);
@@ -3326,6 +3419,8 @@ int		 window_pane_key(struct window_pane *, struct client *,
 void		 window_pane_paste(struct window_pane *, key_code, char *,
 		     size_t);
 int		 window_pane_visible(struct window_pane *);
+void		 window_update_observers(void);
+int		 window_pane_observed(struct window_pane *);
 int		 window_pane_exited(struct window_pane *);
 u_int		 window_pane_search(struct window_pane *, const char *, int,
 		     int);
@@ -3504,6 +3599,8 @@ int	control_all_done(struct client *);
 void	control_add_sub(struct client *, const char *, enum control_sub_type,
     	   int, const char *);
 void	control_remove_sub(struct client *, const char *);
+void	control_frame_header(u_char *, u_char, u_int, uint64_t, size_t);
+void	control_escape_data(struct evbuffer *, const u_char *, size_t);
 
 /* control-notify.c */
 void	control_notify_pane_mode_changed(int);
@@ -3594,6 +3691,10 @@ char		*osdep_get_name(int, char *);
 char		*osdep_get_cwd(int);
 struct event_base *osdep_event_init(void);
 
+/* utf8-width.c */
+extern const char *utf8_table_version;
+int		 utf8_table_width(wchar_t);
+
 /* utf8-combined.c */
 int		 utf8_has_zwj(const struct utf8_data *);
 int		 utf8_is_zwj(const struct utf8_data *);
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+#
+# Generate utf8-width.c, the table of Unicode character widths, from the
+# Unicode database built into Python:
+#
+#	python3 tools/utf8-width.py >utf8-width.c
+#
+# The widths follow the usual wcwidth rules: combining marks, format
+# characters and conjoining Hangul vowels and final consonants are zero
+# width, East Asian wide and fullwidth characters are two, and everything
+# else is one. Codepoints not assigned in this version of Unicode are marked
+# so tmux can ask the C library instead, which may know a later version.
+#
+# The table depends on the version of Unicode in Python, so this refuses to
+# run with any other version than UNICODE_VERSION. Change it to update the
+# table to a new version.
+
+import sys
+import unicodedata
+
+UNICODE_VERSION = '14.0.0'
+if unicodedata.unidata_version != UNICODE_VERSION:
+    sys.exit('Python has Unicode %s, not %s' %
+             (unicodedata.unidata_version, UNICODE_VERSION))
+
+# Width of codepoints which are not assigned.
+UNASSIGNED = 3
+
+# Prepended concatenation marks are format characters but are visible.
+PREPENDED = [0x600, 0x601, 0x602, 0x603, 0x604, 0x605, 0x6dd, 0x70f, 0x890,
+             0x891, 0x8e2, 0x110bd, 0x110cd]
+
+def width(cp):
+    if cp < 0x20 or (cp >= 0x7f and cp <= 0x9f):
+        return 0
+    if cp >= 0xd800 and cp <= 0xdfff:
+        return 1
+    ch = chr(cp)
+    category = unicodedata.category(ch)
+    if category == 'Cn':
+        return UNASSIGNED
+    if cp == 0xad or cp in PREPENDED:
+        return 1
+    if category in ('Mn', 'Me', 'Cf'):
+        return 0
+    if (cp >= 0x1160 and cp <= 0x11ff) or (cp >= 0xd7b0 and cp <= 0xd7ff):
+        return 0
+    if cp == 0x200b:
+        return 0
+    if unicodedata.east_asian_width(ch) in ('W', 'F'):
+        return 2
+    return 1
+
+blocks = {}
+index = []
+for block in range(0x110000 >> 8):
+    packed = []
+    for cp in range(block << 8, (block + 1) << 8, 4):
+        byte = 0
+        for i in range(4):
+            byte |= width(cp + i) << (i * 2)
+        packed.append(byte)
+    packed = tuple(packed)
+    if packed not in blocks:
+        blocks[packed] = len(blocks)
+    index.append(blocks[packed])
+if len(blocks) > 256:
+    sys.exit('too many blocks')
+
+out = sys.stdout
+out.write('''/* $OpenBSD$ */
+
+/*
+ * Copyright (c) 2026 The tmux authors
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF MIND, USE, DATA OR PROFITS, WHETHER
+ * IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING
+ * OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/* Generated by tools/utf8-width.py from Unicode %s. Do not edit. */
+
+#include <sys/types.h>
+
+#include "tmux.h"
+
+/* Version of Unicode the table was generated from. */
+const char *utf8_table_version = "%s";
+
+/*
+ * Widths of each Unicode codepoint, two bits each. The block for a codepoint
+ * is found from its top bits in utf8_width_index and the width from the bottom
+ * eight bits in that block of utf8_width_blocks. A width of three means the
+ * codepoint is not assigned in this version of Unicode.
+ */
+''' % (UNICODE_VERSION, UNICODE_VERSION))
+
+out.write('static const u_char utf8_width_index[%u] = {\n' % len(index))
+for i in range(0, len(index), 12):
+    row = ', '.join('%3u' % n for n in index[i:i + 12])
+    out.write('\t%s%s\n' % (row, ',' if i + 12 < len(index) else ''))
+out.write('};\n\n')
+
+out.write('static const u_char utf8_width_blocks[%u][64] = {\n' % len(blocks))
+ordered = sorted(blocks, key=lambda b: blocks[b])
+for n, packed in enumerate(ordered):
+    out.write('\t{ /* %u */\n' % n)
+    for i in range(0, 64, 8):
+        row = ', '.join('0x%02x' % b for b in packed[i:i + 8])
+        out.write('\t\t%s%s\n' % (row, ',' if i + 8 < 64 else ''))
+    out.write('\t}%s\n' % (',' if n + 1 < len(ordered) else ''))
+out.write('};\n\n')
+
+out.write('''/* Look up the width of a codepoint, or -1 if it is not assigned. */
+int
+utf8_table_width(wchar_t wc)
+{
+	u_int	block, cp = wc, width;
+
+	if (wc < 0 || cp >= 0x110000)
+		return (-1);
+	block = utf8_width_index[cp >> 8];
+	width = utf8_width_blocks[block][(cp & 0xff) >> 2];
+	width = (width >> ((cp & 3) * 2)) & 3;
+	if (width == %u)
+		return (-1);
+	return (width);
+}
+''' % UNASSIGNED)
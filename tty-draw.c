@@ -43,6 +43,18 @@ static const char* tty_draw_line_states[] = {
 	"DONE"
 };
 
+/* Unchanged cells between changed cells which are drawn anyway. */
+#define TTY_DRAW_LINE_GAP 8
+
+/* A cell in the line being drawn. */
+struct tty_draw_line_cell {
+	struct grid_cell	gc;
+	u_int			width;
+	int			empty;
+	int			changed;
+	int			record;
+};
+
 /* Clear part of the line. */
 static void
 tty_draw_line_clear(struct tty *tty, u_int px, u_int py, u_int nx,
@@ -106,102 +118,24 @@ tty_draw_line_get_empty(const struct grid_cell *gc, u_int nx)
 	return (empty);
 }
 
-/* Draw a line from screen to tty. */
-void
-tty_draw_line(struct tty *tty, struct screen *s, u_int px, u_int py, u_int nx,
-    u_int atx, u_int aty, const struct grid_cell *defaults,
-    struct colour_palette *palette)
+/* Draw part of a line from screen to tty. */
+static void
+tty_draw_line_cells(struct tty *tty, struct screen *s, u_int px, u_int py,
+    u_int nx, u_int ex, u_int atx, u_int aty,
+    const struct grid_cell *defaults, struct colour_palette *palette,
+    int wrapped)
 {
 	struct grid		*gd = s->grid;
 	const struct grid_cell	*gcp;
 	struct grid_cell	 gc, ngc, last;
-	struct grid_line	*gl;
-	u_int			 i, j, last_i, cx, ex, width;
-	u_int			 cellsize, bg;
-	int			 flags, empty, wrapped = 0;
+	u_int			 i, j, last_i, width;
+	int			 empty;
 	char			 buf[1000];
 	size_t			 len;
 	enum tty_draw_line_state current_state, next_state;
 
-	/*
-	 * py is the line in the screen to draw. px is the start x and nx is
-	 * the width to draw. atx,aty is the line on the terminal to draw it.
-	 */
-	log_debug("%s: px=%u py=%u nx=%u atx=%u aty=%u", __func__, px, py, nx,
-	    atx, aty);
-
-	/*
-	 * Clamp the width to cellsize - note this is not cellused, because
-	 * there may be empty background cells after it (from BCE).
-	 */
-	cellsize = grid_get_line(gd, gd->hsize + py)->cellsize;
-	if (screen_size_x(s) > cellsize)
-		ex = cellsize;
-	else {
-		ex = screen_size_x(s);
-		if (px > ex)
-			return;
-		if (px + nx > ex)
-			nx = ex - px;
-	}
-	if (ex < nx)
-		ex = nx;
-	log_debug("%s: drawing %u-%u,%u (end %u) at %u,%u; defaults: fg=%d, "
-	    "bg=%d", __func__, px, px + nx, py, ex, atx, aty, defaults->fg,
-	    defaults->bg);
-
-	/*
-	 * If there is padding at the start, we must have truncated a wide
-	 * character. Clear it.
-	 */
-	cx = 0;
-	for (i = px; i < px + nx; i++) {
-		grid_view_get_cell(gd, i, py, &gc);
-		if (~gc.flags & GRID_FLAG_PADDING)
-			break;
-		cx++;
-	}
-	if (cx != 0) {
-		/* Find the previous cell for the background colour. */
-		for (i = px + 1; i > 0; i--) {
-			grid_view_get_cell(gd, i - 1, py, &gc);
-			if (~gc.flags & GRID_FLAG_PADDING)
-				break;
-		}
-		if (i == 0)
-			bg = defaults->bg;
-		else {
-			bg = gc.bg;
-			if (gc.flags & GRID_FLAG_SELECTED) {
-				memcpy(&ngc, &gc, sizeof ngc);
-				if (screen_select_cell(s, &ngc, &gc))
-					bg = ngc.bg;
-			}
-		}
-		tty_attributes(tty, &last, defaults, palette, s->hyperlinks);
-		log_debug("%s: clearing %u padding cells", __func__, cx);
-		tty_draw_line_clear(tty, atx, aty, cx, defaults, bg, 0);
-		if (cx == ex)
-			return;
-		atx += cx;
-		px += cx;
-		nx -= cx;
-		ex -= cx;
-	}
-
-	/* Did the previous line wrap on to this one? */
-	if (py != 0 && atx == 0 && tty->cx >= tty->sx && nx == tty->sx) {
-		gl = grid_get_line(gd, gd->hsize + py - 1);
-		if (gl->flags & GRID_LINE_WRAPPED)
-			wrapped = 1;
-	}
-
-	/* Turn off cursor while redrawing and reset region and margins. */
-	flags = (tty->flags & TTY_NOCURSOR);
-	tty->flags |= TTY_NOCURSOR;
-	tty_update_mode(tty, tty->mode, s);
-	tty_region_off(tty);
-	tty_margin_off(tty);
+	log_debug("%s: drawing %u-%u,%u (end %u) at %u,%u", __func__, px,
+	    px + nx, py, ex, atx, aty);
 
 	/* Start with the default cell as the last cell. */
 	memcpy(&last, &grid_default_cell, sizeof last);
@@ -250,7 +184,8 @@ tty_draw_line(struct tty *tty, struct screen *s, u_int px, u_int py, u_int nx,
 				next_state = TTY_DRAW_LINE_SAME;
 			else if (gcp->flags & GRID_FLAG_PADDING)
 				next_state = TTY_DRAW_LINE_PAD;
-			else if (grid_cells_look_equal(gcp, &last)) {
+			else if (grid_cells_look_equal(gcp, &last) &&
+			    gcp->us == last.us) {
 				if (gcp->data.size > (sizeof buf) - len)
 					next_state = TTY_DRAW_LINE_FLUSH;
 				else
@@ -265,8 +200,12 @@ tty_draw_line(struct tty *tty, struct screen *s, u_int px, u_int py, u_int nx,
 		    tty_draw_line_states[current_state],
 		    tty_draw_line_states[next_state]);
 
-		/* If the state has changed, flush any collected data. */
-		if (next_state != current_state) {
+		/*
+		 * If the state has changed, flush any collected data. Empty
+		 * cells are also flushed if the background changes.
+		 */
+		if (next_state != current_state ||
+		    (next_state == TTY_DRAW_LINE_EMPTY && gcp->bg != last.bg)) {
 			if (current_state == TTY_DRAW_LINE_EMPTY) {
 				tty_attributes(tty, &last, defaults, palette,
 				    s->hyperlinks);
@@ -312,8 +251,235 @@ tty_draw_line(struct tty *tty, struct screen *s, u_int px, u_int py, u_int nx,
 		else
 			i += gcp->data.width;
 	}
+}
 
-	tty->flags = (tty->flags & ~TTY_NOCURSOR)|flags;
-	tty_update_mode(tty, tty->mode, s);
+/*
+ * Work out what each cell in the line will look like once drawn and whether
+ * the terminal is already showing it. Only the first cell of each character
+ * or empty area has its width set and is marked as changed or not.
+ */
+static struct tty_draw_line_cell *
+tty_draw_line_get_cells(struct tty *tty, struct screen *s, u_int px, u_int py,
+    u_int nx, u_int ex, u_int atx, u_int aty,
+    const struct grid_cell *defaults, struct colour_palette *palette)
+{
+	static struct tty_draw_line_cell	*cells;
+	static u_int				 ncells;
+	struct tty_draw_line_cell		*tc;
+	struct grid				*gd = s->grid;
+	const struct grid_cell			*gcp;
+	struct grid_cell			 gc, ngc;
+	u_int					 i, j, n;
+
+	if (nx > ncells) {
+		cells = xreallocarray(cells, nx, sizeof *cells);
+		ncells = nx;
+	}
+
+	for (i = 0; i < nx; i += n) {
+		tc = &cells[i];
+
+		grid_view_get_cell(gd, px + i, py, &gc);
+		gcp = tty_check_codeset(tty, &gc);
+		if (gcp->flags & GRID_FLAG_SELECTED) {
+			memcpy(&ngc, gcp, sizeof ngc);
+			if (screen_select_cell(s, &ngc, gcp))
+				gcp = &ngc;
+		}
+
+		/*
+		 * Empty cells are cleared to the background colour. Padding
+		 * not after a wide character is not drawn at all.
+		 */
+		if (i >= ex)
+			n = 1;
+		else
+			n = tty_draw_line_get_empty(gcp, nx - i);
+		tc->empty = (n != 0);
+		tc->record = 1;
+		if (n != 0) {
+			memcpy(&ngc, &grid_default_cell, sizeof ngc);
+			ngc.bg = gcp->bg;
+			tty_shadow_cell(tty, &ngc, defaults, palette, &tc->gc);
+		} else {
+			tty_shadow_cell(tty, gcp, defaults, palette, &tc->gc);
+			if (gcp->flags & GRID_FLAG_PADDING)
+				tc->record = 0;
+			n = gcp->data.width;
+		}
+		if (n > nx - i)
+			n = nx - i;
+		tc->width = n;
+
+		tc->changed = !tc->record ||
+		    !tty_shadow_same(tty, atx + i, aty, &tc->gc);
+		for (j = 1; j < n; j++) {
+			memcpy(&tc[j].gc, &tc->gc, sizeof tc->gc);
+			if (tc->gc.data.width != 1)
+				tc[j].gc.flags |= GRID_FLAG_PADDING;
+			tc[j].record = tc->record;
+			if (!tc->changed &&
+			    !tty_shadow_same(tty, atx + i + j, aty, &tc[j].gc))
+				tc->changed = 1;
+		}
+	}
+	return (cells);
 }
 
+/* Draw a line from screen to tty. */
+void
+tty_draw_line(struct tty *tty, struct screen *s, u_int px, u_int py, u_int nx,
+    u_int atx, u_int aty, const struct grid_cell *defaults,
+    struct colour_palette *palette)
+{
+	struct grid			*gd = s->grid;
+	struct grid_cell		 gc, ngc, last;
+	struct grid_line		*gl;
+	struct tty_draw_line_cell	*cells, *tc;
+	u_int				 i, j, cx, ex, eol, start, end;
+	u_int				 cellsize, bg;
+	int				 flags, empty, wrapped = 0;
+
+	/*
+	 * py is the line in the screen to draw. px is the start x and nx is
+	 * the width to draw. atx,aty is the line on the terminal to draw it.
+	 */
+	log_debug("%s: px=%u py=%u nx=%u atx=%u aty=%u", __func__, px, py, nx,
+	    atx, aty);
+
+	/*
+	 * Clamp the width to cellsize - note this is not cellused, because
+	 * there may be empty background cells after it (from BCE).
+	 */
+	cellsize = grid_get_line(gd, gd->hsize + py)->cellsize;
+	if (screen_size_x(s) > cellsize)
+		ex = cellsize;
+	else {
+		ex = screen_size_x(s);
+		if (px > ex)
+			return;
+		if (px + nx > ex)
+			nx = ex - px;
+	}
+	if (ex < nx)
+		ex = nx;
+	log_debug("%s: drawing %u-%u,%u (end %u) at %u,%u; defaults: fg=%d, "
+	    "bg=%d", __func__, px, px + nx, py, ex, atx, aty, defaults->fg,
+	    defaults->bg);
+
+	/* Anything drawn here is recorded in the shadow afterwards. */
+	flags = (tty->flags & (TTY_NOCURSOR|TTY_SHADOWING));
+	tty->flags |= TTY_SHADOWING;
+
+	/*
+	 * If there is padding at the start, we must have truncated a wide
+	 * character. Clear it.
+	 */
+	cx = 0;
+	for (i = px; i < px + nx; i++) {
+		grid_view_get_cell(gd, i, py, &gc);
+		if (~gc.flags & GRID_FLAG_PADDING)
+			break;
+		cx++;
+	}
+	if (cx != 0) {
+		/* Find the previous cell for the background colour. */
+		for (i = px + 1; i > 0; i--) {
+			grid_view_get_cell(gd, i - 1, py, &gc);
+			if (~gc.flags & GRID_FLAG_PADDING)
+				break;
+		}
+		if (i == 0)
+			bg = defaults->bg;
+		else {
+			bg = gc.bg;
+			if (gc.flags & GRID_FLAG_SELECTED) {
+				memcpy(&ngc, &gc, sizeof ngc);
+				if (screen_select_cell(s, &ngc, &gc))
+					bg = ngc.bg;
+			}
+		}
+		memcpy(&last, &grid_default_cell, sizeof last);
+		last.bg = bg;
+		tty_attributes(tty, &last, defaults, palette, s->hyperlinks);
+		log_debug("%s: clearing %u padding cells", __func__, cx);
+		tty_draw_line_clear(tty, atx, aty, cx, defaults, bg, 0);
+
+		tty_shadow_cell(tty, &last, defaults, palette, &ngc);
+		for (i = 0; i < cx; i++)
+			tty_shadow_set(tty, atx + i, aty, &ngc);
+
+		if (cx == ex) {
+			tty->flags = (tty->flags & ~TTY_SHADOWING)|flags;
+			return;
+		}
+		atx += cx;
+		px += cx;
+		nx -= cx;
+		ex -= cx;
+	}
+
+	/* Did the previous line wrap on to this one? */
+	if (py != 0 && atx == 0 && tty->cx >= tty->sx && nx == tty->sx) {
+		gl = grid_get_line(gd, gd->hsize + py - 1);
+		if (gl->flags & GRID_LINE_WRAPPED)
+			wrapped = 1;
+	}
+
+	/* Turn off cursor while redrawing and reset region and margins. */
+	tty->flags |= TTY_NOCURSOR;
+	tty_update_mode(tty, tty->mode, s);
+	tty_region_off(tty);
+	tty_margin_off(tty);
+
+	/*
+	 * Draw only the parts of the line which the terminal is not already
+	 * showing. Short gaps between changed cells are drawn anyway because
+	 * moving the cursor over them would cost more, as are empty cells
+	 * after changed empty cells if they can be cleared together.
+	 */
+	cells = tty_draw_line_get_cells(tty, s, px, py, nx, ex, atx, aty,
+	    defaults, palette);
+	eol = 0;
+	for (i = 0; i < nx; i += cells[i].width) {
+		if (!cells[i].empty)
+			eol = i + cells[i].width;
+	}
+	if (atx + nx < tty->sx || !tty_term_has(tty->term, TTYC_EL))
+		eol = nx;
+	start = end = 0;
+	empty = 0;
+	for (i = 0; i <= nx; i += tc->width) {
+		tc = &cells[i];
+		if (i != nx && !tc->changed) {
+			if (empty && end == i && tc->empty &&
+			    !tty_fake_bce(tty, defaults, tc->gc.bg) &&
+			    (i >= eol || tty_term_has(tty->term, TTYC_ECH)))
+				end = i + tc->width;
+			continue;
+		}
+		if (end != 0 &&
+		    (i == nx || (i - end >= TTY_DRAW_LINE_GAP && end < eol))) {
+			tty_draw_line_cells(tty, s, px + start, py, end - start,
+			    ex > start ? ex - start : 0, atx + start, aty,
+			    defaults, palette, wrapped && start == 0);
+			for (j = start; j < end; j++) {
+				if (cells[j].record)
+					tty_shadow_set(tty, atx + j, aty,
+					    &cells[j].gc);
+				else
+					tty_shadow_forget(tty, atx + j, aty, 1);
+			}
+			end = 0;
+		}
+		if (i == nx)
+			break;
+		if (end == 0)
+			start = i;
+		end = i + tc->width;
+		empty = tc->empty;
+	}
+
+	tty->flags = (tty->flags & ~(TTY_NOCURSOR|TTY_SHADOWING))|flags;
+	tty_update_mode(tty, tty->mode, s);
+}
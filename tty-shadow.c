@@ -0,0 +1,428 @@
+/* $OpenBSD$ */
+
+/*
+ * Copyright (c) 2026 The tmux authors
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF MIND, USE, DATA OR PROFITS, WHETHER
+ * IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING
+ * OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <sys/types.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "tmux.h"
+
+/*
+ * The shadow is a model of what the terminal is currently showing, so that
+ * redrawing can skip cells which would not change. Cells are stored in a
+ * grid, after default colours and the palette have been applied, and a
+ * single range of known cells is kept for each line. Anything written to the
+ * terminal which is not recorded makes the cells it may have changed unknown.
+ *
+ * The attributes last sent to the terminal (the pen) are kept in the same
+ * form, so that cleared cells can be recorded and known cells can be written
+ * again instead of moving the cursor over them.
+ */
+
+struct tty_shadow_line {
+	u_int		 start;
+	u_int		 end;
+};
+
+struct tty_shadow {
+	struct grid		*grid;
+	u_int			 sx;
+	u_int			 sy;
+	struct tty_shadow_line	*lines;
+
+	struct grid_cell	 pen;
+	int			 pen_valid;
+};
+
+/*
+ * Blank cells look the same whatever their foreground colour, so it is not
+ * kept.
+ */
+static void
+tty_shadow_blank(struct grid_cell *gc)
+{
+	if (gc->attr == 0 &&
+	    gc->link == 0 &&
+	    (~gc->flags & GRID_FLAG_PADDING) &&
+	    gc->data.size == 1 &&
+	    *gc->data.data == ' ') {
+		gc->fg = 8;
+		gc->us = 8;
+	}
+}
+
+/* Get the shadow if it can be used, creating it if needed. */
+static struct tty_shadow *
+tty_shadow_get_shadow(struct tty *tty)
+{
+	struct tty_shadow	*ts = tty->shadow;
+
+	if (tty->term == NULL || (tty->term->flags & TERM_NOAM))
+		return (NULL);
+	if (tty->sx == 0 || tty->sy == 0)
+		return (NULL);
+
+	if (ts != NULL && ts->sx == tty->sx && ts->sy == tty->sy)
+		return (ts);
+	tty_shadow_free(tty);
+
+	ts = tty->shadow = xcalloc(1, sizeof *ts);
+	ts->grid = grid_create(tty->sx, tty->sy, 0);
+	ts->sx = tty->sx;
+	ts->sy = tty->sy;
+	ts->lines = xcalloc(ts->sy, sizeof *ts->lines);
+	return (ts);
+}
+
+/* Free the shadow. */
+void
+tty_shadow_free(struct tty *tty)
+{
+	struct tty_shadow	*ts = tty->shadow;
+
+	if (ts == NULL)
+		return;
+	grid_destroy(ts->grid);
+	free(ts->lines);
+	free(ts);
+	tty->shadow = NULL;
+}
+
+/* Forget everything. */
+void
+tty_shadow_reset(struct tty *tty)
+{
+	struct tty_shadow	*ts = tty->shadow;
+
+	if (ts != NULL)
+		memset(ts->lines, 0, ts->sy * sizeof *ts->lines);
+}
+
+/* Forget part of a line. */
+void
+tty_shadow_forget(struct tty *tty, u_int px, u_int py, u_int nx)
+{
+	struct tty_shadow	*ts = tty->shadow;
+	struct tty_shadow_line	*tsl;
+	u_int			 ex = px + nx;
+
+	if (ts == NULL)
+		return;
+	if (px == UINT_MAX || py == UINT_MAX) {
+		tty_shadow_reset(tty);
+		return;
+	}
+	if (py >= ts->sy || nx == 0)
+		return;
+	tsl = &ts->lines[py];
+
+	if (ex <= tsl->start || px >= tsl->end)
+		return;
+	if (px <= tsl->start && ex >= tsl->end)
+		tsl->start = tsl->end = 0;
+	else if (px <= tsl->start)
+		tsl->start = ex;
+	else if (ex >= tsl->end)
+		tsl->end = px;
+	else if (px - tsl->start >= tsl->end - ex)
+		tsl->end = px;
+	else
+		tsl->start = ex;
+}
+
+/* Forget a set of lines. */
+void
+tty_shadow_forget_lines(struct tty *tty, u_int py, u_int ny)
+{
+	struct tty_shadow	*ts = tty->shadow;
+	u_int			 yy;
+
+	if (ts == NULL)
+		return;
+	if (py == UINT_MAX || ny == UINT_MAX) {
+		tty_shadow_reset(tty);
+		return;
+	}
+	for (yy = py; yy < py + ny && yy < ts->sy; yy++)
+		ts->lines[yy].start = ts->lines[yy].end = 0;
+}
+
+/* Get a known cell. Returns 0 if the cell is not known. */
+int
+tty_shadow_get(struct tty *tty, u_int px, u_int py, struct grid_cell *gc)
+{
+	struct tty_shadow	*ts = tty_shadow_get_shadow(tty);
+	struct tty_shadow_line	*tsl;
+
+	if (ts == NULL || py >= ts->sy || px >= ts->sx)
+		return (0);
+	tsl = &ts->lines[py];
+	if (px < tsl->start || px >= tsl->end)
+		return (0);
+	grid_get_cell(ts->grid, px, py, gc);
+	return (1);
+}
+
+/*
+ * Record a cell as known. If it is not next to the known cells on the line it
+ * is only kept if none of the line is known.
+ */
+void
+tty_shadow_set(struct tty *tty, u_int px, u_int py, const struct grid_cell *gc)
+{
+	struct tty_shadow	*ts = tty_shadow_get_shadow(tty);
+	struct tty_shadow_line	*tsl;
+	struct grid_cell	 sgc;
+
+	if (ts == NULL || py >= ts->sy || px >= ts->sx)
+		return;
+	tsl = &ts->lines[py];
+
+	if (tsl->start == tsl->end) {
+		tsl->start = px;
+		tsl->end = px + 1;
+	} else if (px == tsl->end)
+		tsl->end++;
+	else if (px + 1 == tsl->start)
+		tsl->start--;
+	else if (px < tsl->start || px > tsl->end)
+		return;
+	memcpy(&sgc, gc, sizeof sgc);
+	tty_shadow_blank(&sgc);
+	grid_set_cell(ts->grid, px, py, &sgc);
+}
+
+/*
+ * Work out how a cell will look on the terminal, applying the default colours
+ * and palette as tty_attributes does.
+ */
+void
+tty_shadow_cell(struct tty *tty, const struct grid_cell *gc,
+    const struct grid_cell *defaults, struct colour_palette *palette,
+    struct grid_cell *out)
+{
+	int	c;
+
+	memcpy(out, gc, sizeof *out);
+	out->flags &= ~(GRID_FLAG_SELECTED|GRID_FLAG_CLEARED);
+	if (gc->flags & GRID_FLAG_CLEARED)
+		utf8_set(&out->data, ' ');
+	if (gc->flags & GRID_FLAG_NOPALETTE)
+		return;
+
+	if (out->fg == 8)
+		out->fg = defaults->fg;
+	if (out->bg == 8)
+		out->bg = defaults->bg;
+
+	c = out->fg;
+	if (c < 8 &&
+	    (out->attr & GRID_ATTR_BRIGHT) &&
+	    !tty_term_has(tty->term, TTYC_NOBR))
+		c += 90;
+	if ((c = colour_palette_get(palette, c)) != -1)
+		out->fg = c;
+	if ((c = colour_palette_get(palette, out->bg)) != -1)
+		out->bg = c;
+	if ((c = colour_palette_get(palette, out->us)) != -1)
+		out->us = c;
+}
+
+/* Would this cell look the same as the one on the terminal? */
+int
+tty_shadow_same(struct tty *tty, u_int px, u_int py, const struct grid_cell *gc)
+{
+	struct grid_cell	ngc, last;
+
+	if (gc->link != 0 || !tty_shadow_get(tty, px, py, &last))
+		return (0);
+	if (last.link != 0)
+		return (0);
+	memcpy(&ngc, gc, sizeof ngc);
+	tty_shadow_blank(&ngc);
+	if (last.us != ngc.us)
+		return (0);
+	return (grid_cells_equal(&ngc, &last));
+}
+
+/*
+ * Is the terminal already showing this cell? Used for cells drawn with
+ * tty_cell.
+ */
+int
+tty_shadow_check(struct tty *tty, u_int px, u_int py,
+    const struct grid_cell *gc, const struct grid_cell *defaults,
+    struct colour_palette *palette)
+{
+	struct grid_cell	sgc;
+
+	if (gc->data.width != 1 || (gc->flags & GRID_FLAG_PADDING))
+		return (0);
+	tty_shadow_cell(tty, tty_check_codeset(tty, gc), defaults, palette,
+	    &sgc);
+	return (tty_shadow_same(tty, px, py, &sgc));
+}
+
+/* Record the attributes sent to the terminal. */
+void
+tty_shadow_set_pen(struct tty *tty, const struct grid_cell *gc,
+    const struct grid_cell *defaults, struct colour_palette *palette)
+{
+	struct tty_shadow	*ts = tty_shadow_get_shadow(tty);
+
+	if (ts == NULL)
+		return;
+	tty_shadow_cell(tty, gc, defaults, palette, &ts->pen);
+	ts->pen_valid = 1;
+}
+
+/* Forget the attributes sent to the terminal. */
+void
+tty_shadow_clear_pen(struct tty *tty)
+{
+	struct tty_shadow	*ts = tty->shadow;
+
+	if (ts != NULL)
+		ts->pen_valid = 0;
+}
+
+/*
+ * Get the text of a set of known cells if writing it with the current
+ * attributes would not change them. Only plain ASCII is used.
+ */
+int
+tty_shadow_get_text(struct tty *tty, u_int px, u_int py, u_int nx, char *buf)
+{
+	struct tty_shadow	*ts = tty->shadow;
+	struct grid_cell	*pen, gc;
+	u_int			 i;
+	u_char			 ch;
+
+	if (ts == NULL || !ts->pen_valid)
+		return (0);
+	pen = &ts->pen;
+	if (pen->link != 0 || (pen->attr & GRID_ATTR_CHARSET))
+		return (0);
+
+	for (i = 0; i < nx; i++) {
+		if (!tty_shadow_get(tty, px + i, py, &gc))
+			return (0);
+		if (gc.data.size != 1 || gc.data.width != 1 || gc.link != 0)
+			return (0);
+		if (gc.flags & GRID_FLAG_PADDING)
+			return (0);
+		ch = *gc.data.data;
+		if (ch < 0x20 || ch > 0x7e)
+			return (0);
+		if (gc.attr != pen->attr || gc.bg != pen->bg)
+			return (0);
+		if (ch != ' ' || gc.attr != 0) {
+			if (gc.fg != pen->fg || gc.us != pen->us)
+				return (0);
+		}
+		buf[i] = ch;
+	}
+	return (1);
+}
+
+/*
+ * Record part of a line as cleared to the current background colour. If the
+ * colour is not known, forget it instead.
+ */
+void
+tty_shadow_clear(struct tty *tty, u_int px, u_int py, u_int nx)
+{
+	struct tty_shadow	*ts = tty->shadow;
+	struct tty_shadow_line	*tsl;
+	struct grid_cell	 gc;
+	u_int			 ex, i;
+
+	if (ts == NULL || py >= ts->sy || px >= ts->sx || nx == 0)
+		return;
+	if (px + nx > ts->sx)
+		nx = ts->sx - px;
+	ex = px + nx;
+
+	/*
+	 * Terminals without BCE should clear to the default background, but
+	 * some do not, so only a default background is certain.
+	 */
+	if (!ts->pen_valid ||
+	    (ts->pen.attr != 0) ||
+	    (!COLOUR_DEFAULT(ts->pen.bg) &&
+	    !tty_term_flag(tty->term, TTYC_BCE))) {
+		tty_shadow_forget(tty, px, py, nx);
+		return;
+	}
+	memcpy(&gc, &grid_default_cell, sizeof gc);
+	gc.bg = ts->pen.bg;
+
+	/* Join the cleared cells to the known cells or replace them. */
+	tsl = &ts->lines[py];
+	if (tsl->start == tsl->end || (px <= tsl->end && ex >= tsl->start)) {
+		if (tsl->start == tsl->end || px < tsl->start)
+			tsl->start = px;
+		if (ex > tsl->end)
+			tsl->end = ex;
+	} else if (nx >= tsl->end - tsl->start) {
+		tsl->start = px;
+		tsl->end = ex;
+	} else
+		return;
+	for (i = px; i < ex; i++)
+		grid_set_cell(ts->grid, i, py, &gc);
+}
+
+/*
+ * Move the lines in a region up (positive) or down (negative), as the
+ * terminal does when scrolling. New lines are cleared.
+ */
+void
+tty_shadow_scroll(struct tty *tty, u_int upper, u_int lower, int lines)
+{
+	struct tty_shadow	*ts = tty->shadow;
+	u_int			 ny, n, yy;
+
+	if (ts == NULL)
+		return;
+	if (upper > lower || lower >= ts->sy) {
+		tty_shadow_reset(tty);
+		return;
+	}
+	ny = lower - upper + 1;
+	n = (lines < 0) ? -lines : lines;
+	if (n == 0)
+		return;
+
+	if (n < ny && lines > 0) {
+		grid_move_lines(ts->grid, upper, upper + n, ny - n, 8);
+		memmove(&ts->lines[upper], &ts->lines[upper + n],
+		    (ny - n) * sizeof *ts->lines);
+		upper = lower - n + 1;
+	} else if (n < ny) {
+		grid_move_lines(ts->grid, upper + n, upper, ny - n, 8);
+		memmove(&ts->lines[upper + n], &ts->lines[upper],
+		    (ny - n) * sizeof *ts->lines);
+		lower = upper + n - 1;
+	}
+	for (yy = upper; yy <= lower; yy++) {
+		ts->lines[yy].start = ts->lines[yy].end = 0;
+		tty_shadow_clear(tty, 0, yy, ts->sx);
+	}
+}
@@ -441,7 +441,7 @@ tty_term_apply_overrides(struct tty_term *term)
 	struct options_array_item	*a;
 	union options_value		*ov;
 	const char			*s, *acs;
-	size_t				 offset;
+	size_t				 offset, len;
 	char				*first;
 
 	/* Update capabilities from the option. */
@@ -510,6 +510,24 @@ tty_term_apply_overrides(struct tty_term *term)
 		term->flags &= ~TERM_NOAM;
 	log_debug("NOAM flag is %d", !!(term->flags & TERM_NOAM));
 
+	/*
+	 * Terminals with AX (so SGR 39 and 49 work) and a plain sgr0 (perhaps
+	 * with SI to reset the character set) are assumed to support the other
+	 * standard SGR sequences to turn off single attributes, which can be
+	 * shorter than resetting everything.
+	 */
+	s = tty_term_string(term, TTYC_SGR0);
+	len = strlen(s);
+	if (len != 0 && s[len - 1] == '\017')
+		len--;
+	if (tty_term_flag(term, TTYC_AX) &&
+	    ((len >= 3 && strncmp(s + len - 3, "\033[m", 3) == 0) ||
+	    (len >= 4 && strncmp(s + len - 4, "\033[0m", 4) == 0)))
+		term->flags |= TERM_SGR;
+	else
+		term->flags &= ~TERM_SGR;
+	log_debug("SGR flag is %d", !!(term->flags & TERM_SGR));
+
 	/* Generate ACS table. If none is present, use nearest ASCII. */
 	memset(term->acs, 0, sizeof term->acs);
 	if (tty_term_has(term, TTYC_ACSC))
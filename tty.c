@@ -44,6 +44,8 @@ static void	tty_cursor_pane(struct tty *, const struct tty_ctx *, u_int,
 		    u_int);
 static void	tty_cursor_pane_unless_wrap(struct tty *,
 		    const struct tty_ctx *, u_int, u_int);
+static void	tty_attributes_set(struct tty *, const struct grid_cell *,
+		    int);
 static void	tty_colours(struct tty *, const struct grid_cell *);
 static void	tty_check_fg(struct tty *, struct colour_palette *,
 		    struct grid_cell *);
@@ -77,13 +79,40 @@ static void	tty_write_one(void (*)(struct tty *, const struct tty_ctx *),
 #define tty_full_width(tty, ctx) \
 	((ctx)->xoff == 0 && (ctx)->sx >= (tty)->sx)
 
-#define TTY_BLOCK_INTERVAL (100000 /* 100 milliseconds */)
 #define TTY_BLOCK_START(tty) (1 + ((tty)->sx * (tty)->sy) * 8)
 #define TTY_BLOCK_STOP(tty) (1 + ((tty)->sx * (tty)->sy) / 8)
 
 #define TTY_QUERY_TIMEOUT 5
 #define TTY_REQUEST_LIMIT 30
 
+#define TTY_OUT_SIZE 16384
+#define TTY_OUT_KEEP 262144
+
+/*
+ * Output from tty_attributes is collected here rather than sent straight to
+ * the terminal. Adjacent SGR sequences (CSI ... m) are combined into one and
+ * anything else is copied unchanged.
+ */
+#define TTY_SGR_SIZE 256
+
+/*
+ * Most terminals only keep the first 16 parameters of a sequence (NPAR in the
+ * Linux console, ESC_ARG_SIZ in st) and ignore the rest, so never combine
+ * more than this.
+ */
+#define TTY_SGR_MAX_PARAMS 16
+struct tty_sgr {
+	char	out[TTY_SGR_SIZE];
+	size_t	used;
+
+	char	params[TTY_SGR_SIZE];
+	size_t	nparams;
+	u_int	count;
+
+	size_t	raw;
+	int	overflow;
+};
+
 void
 tty_create_log(void)
 {
@@ -188,54 +217,197 @@ tty_read_callback(__unused int fd, __unused short events, void *data)
 		;
 }
 
+/*
+ * The terminal has caught up after being blocked. Redraw the lines that were
+ * changed in the meantime, or everything if any output had to be thrown away.
+ */
 static void
-tty_timer_callback(__unused int fd, __unused short events, void *data)
+tty_unblock(struct tty *tty)
 {
-	struct tty	*tty = data;
-	struct client	*c = tty->client;
-	struct timeval	 tv = { .tv_usec = TTY_BLOCK_INTERVAL };
-
-	log_debug("%s: %zu discarded", c->name, tty->discarded);
+	struct client		*c = tty->client;
+	struct window_pane	*wp;
+	u_int			 ox, oy, sx, sy, top = 0, bit = 0, y, j;
 
-	c->flags |= CLIENT_ALLREDRAWFLAGS;
-	c->discarded += tty->discarded;
+	tty->flags &= ~TTY_BLOCK;
+	log_debug("%s: caught up, %zu discarded", c->name, tty->discarded);
 
-	if (tty->discarded < TTY_BLOCK_STOP(tty)) {
-		tty->flags &= ~TTY_BLOCK;
+	if (tty->discarded != 0 || c->session == NULL) {
+		c->discarded += tty->discarded;
+		tty->discarded = 0;
 		tty_invalidate(tty);
+		c->flags |= CLIENT_ALLREDRAWFLAGS;
 		return;
 	}
-	tty->discarded = 0;
-	evtimer_add(&tty->timer, &tv);
+	if (c->flags & CLIENT_REDRAWWINDOW)
+		return;
+
+	tty_window_offset(tty, &ox, &oy, &sx, &sy);
+	if (status_at_line(c) == 0)
+		top = status_line_size(c);
+	TAILQ_FOREACH(wp, &c->session->curw->window->panes, entry) {
+		if (bit == 64) {
+			c->flags |= CLIENT_REDRAWWINDOW;
+			return;
+		}
+		for (j = 0; j < wp->sy; j++) {
+			if (wp->yoff + j < oy || wp->yoff + j >= oy + sy)
+				continue;
+			y = top + wp->yoff + j - oy;
+			if (y < tty->dirty_size && bit_test(tty->dirty, y)) {
+				log_debug("%s: pane %%%u changed", c->name,
+				    wp->id);
+				c->redraw_panes |= (1 << bit);
+				tty->flags |= TTY_DIRTY;
+				break;
+			}
+		}
+		bit++;
+	}
+	if (c->redraw_panes != 0)
+		c->flags |= CLIENT_REDRAWPANES;
+	if (c->overlay_draw != NULL)
+		c->flags |= CLIENT_REDRAWOVERLAY;
 }
 
-static int
+/*
+ * Mark all of a pane as changed, if only changed lines are being redrawn.
+ */
+void
+tty_dirty_pane(struct tty *tty, struct window_pane *wp)
+{
+	struct client	*c = tty->client;
+	u_int		 ox, oy, sx, sy, top = 0, j;
+
+	if (~tty->flags & TTY_DIRTY)
+		return;
+
+	tty_window_offset(tty, &ox, &oy, &sx, &sy);
+	if (status_at_line(c) == 0)
+		top = status_line_size(c);
+	for (j = 0; j < wp->sy; j++) {
+		if (wp->yoff + j < oy || wp->yoff + j >= oy + sy)
+			continue;
+		if (top + wp->yoff + j - oy < tty->dirty_size)
+			bit_set(tty->dirty, top + wp->yoff + j - oy);
+	}
+}
+
+/*
+ * If the terminal is too far behind, stop sending it pane output until it has
+ * caught up. Output that is already queued is still written.
+ */
+static void
 tty_block_maybe(struct tty *tty)
 {
 	struct client	*c = tty->client;
-	size_t		 size = EVBUFFER_LENGTH(tty->out);
-	struct timeval	 tv = { .tv_usec = TTY_BLOCK_INTERVAL };
+	size_t		 size = tty_output_length(tty);
 
 	if (size == 0)
 		tty->flags &= ~TTY_NOBLOCK;
 	else if (tty->flags & TTY_NOBLOCK)
-		return (0);
+		return;
 
+	if (tty->flags & TTY_BLOCK) {
+		if (size < TTY_BLOCK_STOP(tty))
+			tty_unblock(tty);
+		return;
+	}
 	if (size < TTY_BLOCK_START(tty))
-		return (0);
-
-	if (tty->flags & TTY_BLOCK)
-		return (1);
+		return;
 	tty->flags |= TTY_BLOCK;
 
-	log_debug("%s: can't keep up, %zu discarded", c->name, size);
-
-	evbuffer_drain(tty->out, size);
-	c->discarded += size;
+	log_debug("%s: can't keep up, %zu left", c->name, size);
 
+	if (tty->dirty_size != tty->sy) {
+		free(tty->dirty);
+		if ((tty->dirty = bit_alloc(tty->sy)) == NULL)
+			fatal("bit_alloc failed");
+		tty->dirty_size = tty->sy;
+	} else
+		bit_nclear(tty->dirty, 0, tty->dirty_size - 1);
 	tty->discarded = 0;
-	evtimer_add(&tty->timer, &tv);
-	return (1);
+}
+
+/*
+ * Mark the lines a command would have changed while the terminal is blocked,
+ * so they can be redrawn later instead.
+ */
+static void
+tty_block_mark(struct tty *tty, void (*cmdfn)(struct tty *,
+    const struct tty_ctx *), const struct tty_ctx *ctx)
+{
+	u_int	first, last, y;
+
+	if (cmdfn == tty_cmd_cell ||
+	    cmdfn == tty_cmd_cells ||
+	    cmdfn == tty_cmd_insertcharacter ||
+	    cmdfn == tty_cmd_deletecharacter ||
+	    cmdfn == tty_cmd_clearcharacter ||
+	    cmdfn == tty_cmd_clearline ||
+	    cmdfn == tty_cmd_clearendofline ||
+	    cmdfn == tty_cmd_clearstartofline) {
+		first = ctx->ocy;
+		last = ctx->ocy;
+	} else if (cmdfn == tty_cmd_setselection ||
+	    cmdfn == tty_cmd_rawstring ||
+	    cmdfn == tty_cmd_syncstart)
+		return;
+	else {
+		first = 0;
+		last = ctx->sy - 1;
+	}
+
+	for (y = first; y <= last; y++) {
+		if (ctx->yoff + y < ctx->woy)
+			continue;
+		if (ctx->yoff + y - ctx->woy >= tty->dirty_size)
+			break;
+		bit_set(tty->dirty, ctx->yoff + y - ctx->woy);
+	}
+}
+
+/* Move new output into the buffer. */
+static void
+tty_output_move(struct tty *tty, size_t off)
+{
+	if (off != tty->out_len)
+		evbuffer_add(tty->out, tty->out_buf + off, tty->out_len - off);
+	tty->out_len = 0;
+
+	/* Do not keep a large buffer around after a big redraw. */
+	if (tty->out_space > TTY_OUT_KEEP) {
+		free(tty->out_buf);
+		tty->out_buf = NULL;
+		tty->out_space = 0;
+	}
+}
+
+/*
+ * Work out how quickly the terminal consumed the last redraw, to decide how
+ * long to wait before the next.
+ */
+static void
+tty_write_rate(struct client *c)
+{
+	struct timeval	tv;
+	uint64_t	usec, rate;
+
+	if (c->redraw_size == 0 || gettimeofday(&tv, NULL) != 0)
+		return;
+	if (timercmp(&tv, &c->redraw_last, <))
+		return;
+	timersub(&tv, &c->redraw_last, &tv);
+	usec = (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+	if (usec < 1000)
+		usec = 1000;
+	rate = ((uint64_t)c->redraw_size * 1000000) / usec;
+
+	if (c->write_rate == 0)
+		c->write_rate = rate;
+	else
+		c->write_rate = (c->write_rate * 3 + rate) / 4;
+	log_debug("%s: redraw of %zu bytes took %llu us, rate now %zu", c->name,
+	    c->redraw_size, (unsigned long long)usec, c->write_rate);
 }
 
 static void
@@ -243,23 +415,40 @@ tty_write_callback(__unused int fd, __unused short events, void *data)
 {
 	struct tty	*tty = data;
 	struct client	*c = tty->client;
-	size_t		 size = EVBUFFER_LENGTH(tty->out);
-	int		 nwrite;
+	size_t		 size = tty_output_length(tty);
+	ssize_t		 nwrite;
 
-	nwrite = evbuffer_write(tty->out, c->fd);
-	if (nwrite == -1)
-		return;
-	log_debug("%s: wrote %d bytes (of %zu)", c->name, nwrite, size);
+	/*
+	 * If nothing is left over from an earlier write, write new output
+	 * directly and only buffer what does not fit. Otherwise it has to go
+	 * after what is already buffered.
+	 */
+	if (tty->out_len != 0 && EVBUFFER_LENGTH(tty->out) == 0) {
+		nwrite = write(c->fd, tty->out_buf, tty->out_len);
+		if (nwrite == -1) {
+			tty_output_move(tty, 0);
+			return;
+		}
+		tty_output_move(tty, nwrite);
+	} else {
+		if (tty->out_len != 0)
+			tty_output_move(tty, 0);
+		nwrite = evbuffer_write(tty->out, c->fd);
+		if (nwrite == -1)
+			return;
+	}
+	log_debug("%s: wrote %zd bytes (of %zu)", c->name, nwrite, size);
 
 	if (c->redraw > 0) {
-		if ((size_t)nwrite >= c->redraw)
+		if ((size_t)nwrite >= c->redraw) {
 			c->redraw = 0;
-		else
+			tty_write_rate(c);
+		} else
 			c->redraw -= nwrite;
 		log_debug("%s: waiting for redraw, %zu bytes left", c->name,
 		    c->redraw);
-	} else if (tty_block_maybe(tty))
-		return;
+	} else
+		tty_block_maybe(tty);
 
 	if (EVBUFFER_LENGTH(tty->out) != 0)
 		event_add(&tty->event_out, NULL);
@@ -278,7 +467,7 @@ tty_open(struct tty *tty, char **cause)
 	}
 	tty->flags |= TTY_OPENED;
 
-	tty->flags &= ~(TTY_NOCURSOR|TTY_FREEZE|TTY_BLOCK|TTY_TIMER);
+	tty->flags &= ~(TTY_NOCURSOR|TTY_FREEZE|TTY_BLOCK|TTY_DIRTY|TTY_TIMER);
 
 	event_set(&tty->event_in, c->fd, EV_PERSIST|EV_READ,
 	    tty_read_callback, tty);
@@ -293,7 +482,6 @@ tty_open(struct tty *tty, char **cause)
 
 	evtimer_set(&tty->clipboard_timer, tty_clipboard_query_callback, tty);
 	evtimer_set(&tty->start_timer, tty_start_timer_callback, tty);
-	evtimer_set(&tty->timer, tty_timer_callback, tty);
 
 	tty_start_tty(tty);
 	tty_keys_build(tty);
@@ -374,6 +562,8 @@ tty_start_tty(struct tty *tty)
 	tty_start_start_timer(tty);
 
 	tty->flags |= TTY_STARTED;
+	if (tty_output_length(tty) != 0)
+		event_add(&tty->event_out, NULL);
 	tty_invalidate(tty);
 
 	if (tty->ccolour != -1)
@@ -439,12 +629,12 @@ tty_stop_tty(struct tty *tty)
 	if (!(tty->flags & TTY_STARTED))
 		return;
 	tty->flags &= ~TTY_STARTED;
+	tty_shadow_reset(tty);
 
 	evtimer_del(&tty->start_timer);
 	evtimer_del(&tty->clipboard_timer);
 
-	event_del(&tty->timer);
-	tty->flags &= ~TTY_BLOCK;
+	tty->flags &= ~(TTY_BLOCK|TTY_DIRTY);
 
 	event_del(&tty->event_in);
 	event_del(&tty->event_out);
@@ -509,6 +699,9 @@ tty_close(struct tty *tty)
 		event_del(&tty->event_in);
 		evbuffer_free(tty->out);
 		event_del(&tty->event_out);
+		free(tty->out_buf);
+		tty->out_buf = NULL;
+		tty->out_len = tty->out_space = 0;
 
 		tty_term_free(tty->term);
 		tty_keys_free(tty);
@@ -522,7 +715,9 @@ tty_free(struct tty *tty)
 {
 	tty_close(tty);
 
+	tty_shadow_free(tty);
 	free(tty->r.ranges);
+	free(tty->dirty);
 }
 
 void
@@ -572,9 +767,128 @@ tty_raw(struct tty *tty, const char *s)
 	}
 }
 
+/* Update the shadow for a scroll region moving up or down. */
+static void
+tty_shadow_region(struct tty *tty, u_int upper, u_int lower, int lines)
+{
+	if (upper == UINT_MAX || lower == UINT_MAX) {
+		tty_shadow_reset(tty);
+		return;
+	}
+	if (tty_use_margin(tty) &&
+	    (tty->rleft != 0 || tty->rright != tty->sx - 1))
+		tty_shadow_forget_lines(tty, upper, lower - upper + 1);
+	else
+		tty_shadow_scroll(tty, upper, lower, lines);
+}
+
+/* Update the shadow for a capability about to be sent to the terminal. */
+static void
+tty_shadow_code(struct tty *tty, enum tty_code_code code, u_int n)
+{
+	u_int	cx = tty->cx, cy = tty->cy, sx = tty->sx, yy;
+
+	if (!tty_term_has(tty->term, code))
+		return;
+
+	switch (code) {
+	case TTYC_CLEAR:
+		for (yy = 0; yy < tty->sy; yy++)
+			tty_shadow_clear(tty, 0, yy, sx);
+		return;
+	case TTYC_SMCUP:
+	case TTYC_RMCUP:
+		tty_shadow_reset(tty);
+		return;
+	case TTYC_INDN:
+		tty_shadow_region(tty, tty->rupper, tty->rlower, n);
+		return;
+	case TTYC_RIN:
+		tty_shadow_region(tty, tty->rupper, tty->rlower, -(int)n);
+		return;
+	default:
+		break;
+	}
+
+	if (cx == UINT_MAX || cy == UINT_MAX) {
+		tty_shadow_reset(tty);
+		return;
+	}
+	if (cx > sx - 1)
+		cx = sx - 1;
+
+	switch (code) {
+	case TTYC_EL:
+		tty_shadow_clear(tty, cx, cy, sx - cx);
+		break;
+	case TTYC_EL1:
+		tty_shadow_clear(tty, 0, cy, cx + 1);
+		break;
+	case TTYC_ECH:
+		tty_shadow_clear(tty, cx, cy, n);
+		break;
+	case TTYC_ED:
+		tty_shadow_clear(tty, cx, cy, sx - cx);
+		for (yy = cy + 1; yy < tty->sy; yy++)
+			tty_shadow_clear(tty, 0, yy, sx);
+		break;
+	case TTYC_ICH:
+	case TTYC_ICH1:
+	case TTYC_DCH:
+	case TTYC_DCH1:
+		tty_shadow_forget(tty, cx, cy, sx - cx);
+		break;
+	case TTYC_IL:
+	case TTYC_IL1:
+		if (tty->rupper == UINT_MAX || tty->rlower == UINT_MAX)
+			tty_shadow_reset(tty);
+		else if (cy >= tty->rupper && cy <= tty->rlower)
+			tty_shadow_region(tty, cy, tty->rlower, -(int)n);
+		break;
+	case TTYC_DL:
+	case TTYC_DL1:
+		if (tty->rupper == UINT_MAX || tty->rlower == UINT_MAX)
+			tty_shadow_reset(tty);
+		else if (cy >= tty->rupper && cy <= tty->rlower)
+			tty_shadow_region(tty, cy, tty->rlower, n);
+		break;
+	case TTYC_RI:
+		if (tty->rupper == UINT_MAX || cy == tty->rupper)
+			tty_shadow_region(tty, tty->rupper, tty->rlower, -1);
+		break;
+	default:
+		break;
+	}
+}
+
+/* Forget any cells in the shadow which may be changed by writing text. */
+static void
+tty_shadow_text(struct tty *tty, u_int width)
+{
+	u_int	cx = tty->cx, cy = tty->cy;
+
+	if (cx == UINT_MAX || cy == UINT_MAX) {
+		tty_shadow_reset(tty);
+		return;
+	}
+	if (cx + width > tty->sx) {
+		if (cy == tty->rlower) {
+			tty_shadow_forget_lines(tty, tty->rupper,
+			    tty->rlower - tty->rupper + 1);
+		} else
+			tty_shadow_forget_lines(tty, cy + 1, 1);
+		if (cx < tty->sx && (~tty->flags & TTY_SHADOWING))
+			tty_shadow_forget(tty, cx, cy, tty->sx - cx);
+		return;
+	}
+	if (~tty->flags & TTY_SHADOWING)
+		tty_shadow_forget(tty, cx, cy, width);
+}
+
 void
 tty_putcode(struct tty *tty, enum tty_code_code code)
 {
+	tty_shadow_code(tty, code, 1);
 	tty_puts(tty, tty_term_string(tty->term, code));
 }
 
@@ -583,6 +897,7 @@ tty_putcode_i(struct tty *tty, enum tty_code_code code, int a)
 {
 	if (a < 0)
 		return;
+	tty_shadow_code(tty, code, a);
 	tty_puts(tty, tty_term_string_i(tty->term, code, a));
 }
 
@@ -621,26 +936,195 @@ static void
 tty_add(struct tty *tty, const char *buf, size_t len)
 {
 	struct client	*c = tty->client;
+	size_t		 size;
 
 	if (tty->flags & TTY_BLOCK) {
 		tty->discarded += len;
+		tty_shadow_reset(tty);
+		tty_shadow_clear_pen(tty);
 		return;
 	}
 
-	evbuffer_add(tty->out, buf, len);
-	log_debug("%s: %.*s", c->name, (int)len, buf);
+	/*
+	 * Output is collected and written once when the terminal is ready,
+	 * so the write event only needs to be added for the first.
+	 */
+	if (tty->out_len + len > tty->out_space) {
+		size = tty->out_space == 0 ? TTY_OUT_SIZE : tty->out_space;
+		while (size < tty->out_len + len)
+			size *= 2;
+		tty->out_buf = xrealloc(tty->out_buf, size);
+		tty->out_space = size;
+	}
+	memcpy(tty->out_buf + tty->out_len, buf, len);
+	if (tty->out_len == 0 && (tty->flags & TTY_STARTED))
+		event_add(&tty->event_out, NULL);
+	tty->out_len += len;
+
+	if (log_get_level() != 0)
+		log_debug("%s: %.*s", c->name, (int)len, buf);
 	c->written += len;
 
 	if (tty_log_fd != -1)
 		write(tty_log_fd, buf, len);
-	if (tty->flags & TTY_STARTED)
-		event_add(&tty->event_out, NULL);
+}
+
+/* Get the amount of output waiting to be written. */
+size_t
+tty_output_length(struct tty *tty)
+{
+	return (EVBUFFER_LENGTH(tty->out) + tty->out_len);
+}
+
+/* Start collecting output. */
+static void
+tty_sgr_start(struct tty *tty, struct tty_sgr *sgr)
+{
+	sgr->used = 0;
+	sgr->nparams = 0;
+	sgr->count = 0;
+	sgr->raw = 0;
+	sgr->overflow = 0;
+	tty->sgr = sgr;
+}
+
+/* Add to collected output. */
+static void
+tty_sgr_append(struct tty_sgr *sgr, const char *buf, size_t len)
+{
+	if (sgr->used + len > sizeof sgr->out) {
+		sgr->overflow = 1;
+		return;
+	}
+	memcpy(sgr->out + sgr->used, buf, len);
+	sgr->used += len;
+}
+
+/* Add to the parameters of the pending SGR sequence. */
+static void
+tty_sgr_append_params(struct tty_sgr *sgr, const char *buf, size_t len)
+{
+	if (sgr->nparams + len > sizeof sgr->params) {
+		sgr->overflow = 1;
+		return;
+	}
+	memcpy(sgr->params + sgr->nparams, buf, len);
+	sgr->nparams += len;
+}
+
+/* Write the pending SGR sequence, if any. */
+static void
+tty_sgr_flush(struct tty_sgr *sgr)
+{
+	if (sgr->nparams == 0)
+		return;
+	if (sgr->nparams == 1 && sgr->params[0] == '0')
+		tty_sgr_append(sgr, "\033[m", 3);
+	else {
+		tty_sgr_append(sgr, "\033[", 2);
+		tty_sgr_append(sgr, sgr->params, sgr->nparams);
+		tty_sgr_append(sgr, "m", 1);
+	}
+	sgr->nparams = 0;
+	sgr->count = 0;
+}
+
+/* Return the length of an SGR sequence at the start of a string, or zero. */
+static size_t
+tty_sgr_length(const char *s)
+{
+	size_t	n;
+
+	if (s[0] != '\033' || s[1] != '[')
+		return (0);
+	for (n = 2; s[n] != '\0'; n++) {
+		if (s[n] == 'm')
+			return (n + 1);
+		if ((s[n] < '0' || s[n] > '9') && s[n] != ';' && s[n] != ':')
+			return (0);
+	}
+	return (0);
+}
+
+/* Add the parameters of an SGR sequence to the pending sequence. */
+static void
+tty_sgr_add_params(struct tty_sgr *sgr, const char *params, size_t len)
+{
+	size_t	first, i;
+	u_int	count;
+
+	/* Count the parameters, including any colon-separated ones. */
+	count = 1;
+	for (i = 0; i < len; i++) {
+		if (params[i] == ';' || params[i] == ':')
+			count++;
+	}
+
+	/*
+	 * If the first parameter is a reset (0 or empty), any earlier
+	 * parameters are pointless so drop them.
+	 */
+	first = 0;
+	while (first < len && params[first] != ';')
+		first++;
+	if (first == 0 || (first == 1 && params[0] == '0')) {
+		sgr->nparams = 0;
+		tty_sgr_append_params(sgr, "0", 1);
+		tty_sgr_append_params(sgr, params + first, len - first);
+		sgr->count = count;
+		return;
+	}
+
+	/* Write what is pending first if this would make too many. */
+	if (sgr->count + count > TTY_SGR_MAX_PARAMS)
+		tty_sgr_flush(sgr);
+
+	if (sgr->nparams != 0)
+		tty_sgr_append_params(sgr, ";", 1);
+	tty_sgr_append_params(sgr, params, len);
+	sgr->count += count;
+}
+
+/* Add a string to collected output, combining any SGR sequences. */
+static void
+tty_sgr_add(struct tty_sgr *sgr, const char *s)
+{
+	size_t	n;
+
+	sgr->raw += strlen(s);
+	while (*s != '\0') {
+		n = tty_sgr_length(s);
+		if (n != 0) {
+			tty_sgr_add_params(sgr, s + 2, n - 3);
+			s += n;
+			continue;
+		}
+
+		/*
+		 * SI and SO only change the character set so the pending SGR
+		 * sequence can stay pending across them.
+		 */
+		if (*s == '\016' || *s == '\017') {
+			tty_sgr_append(sgr, s, 1);
+			s++;
+			continue;
+		}
+
+		tty_sgr_flush(sgr);
+		n = 1 + strcspn(s + 1, "\033\016\017");
+		tty_sgr_append(sgr, s, n);
+		s += n;
+	}
 }
 
 void
 tty_puts(struct tty *tty, const char *s)
 {
-	if (*s != '\0')
+	if (*s == '\0')
+		return;
+	if (tty->sgr != NULL)
+		tty_sgr_add(tty->sgr, s);
+	else
 		tty_add(tty, s, strlen(s));
 }
 
@@ -655,6 +1139,11 @@ tty_putc(struct tty *tty, u_char ch)
 	    tty->cx + 1 >= tty->sx)
 		return;
 
+	if (ch >= 0x20 && ch != 0x7f)
+		tty_shadow_text(tty, 1);
+	else if (ch == '\n' && tty->cy == tty->rlower)
+		tty_shadow_region(tty, tty->rupper, tty->rlower, 1);
+
 	if (tty->cell.attr & GRID_ATTR_CHARSET) {
 		acs = tty_acs_get(tty, ch);
 		if (acs != NULL)
@@ -690,6 +1179,7 @@ tty_putn(struct tty *tty, const void *buf, size_t len, u_int width)
 	    tty->cx + len >= tty->sx)
 		len = tty->sx - tty->cx - 1;
 
+	tty_shadow_text(tty, width);
 	tty_add(tty, buf, len);
 	if (tty->cx + width > tty->sx) {
 		tty->cx = (tty->cx + width) - tty->sx;
@@ -701,19 +1191,24 @@ tty_putn(struct tty *tty, const void *buf, size_t len, u_int width)
 		tty->cx += width;
 }
 
-static void
-tty_set_italics(struct tty *tty)
+static int
+tty_use_italics(struct tty *tty)
 {
 	const char	*s;
 
-	if (tty_term_has(tty->term, TTYC_SITM)) {
-		s = options_get_string(global_options, "default-terminal");
-		if (strcmp(s, "screen") != 0 && strncmp(s, "screen-", 7) != 0) {
-			tty_putcode(tty, TTYC_SITM);
-			return;
-		}
-	}
-	tty_putcode(tty, TTYC_SMSO);
+	if (!tty_term_has(tty->term, TTYC_SITM))
+		return (0);
+	s = options_get_string(global_options, "default-terminal");
+	return (strcmp(s, "screen") != 0 && strncmp(s, "screen-", 7) != 0);
+}
+
+static void
+tty_set_italics(struct tty *tty)
+{
+	if (tty_use_italics(tty))
+		tty_putcode(tty, TTYC_SITM);
+	else
+		tty_putcode(tty, TTYC_SMSO);
 }
 
 void
@@ -1312,6 +1807,8 @@ tty_clear_area(struct tty *tty, const struct grid_cell *defaults, u_int py,
 			xsnprintf(tmp, sizeof tmp, "\033[32;%u;%u;%u;%u$x",
 			    py + 1, px + 1, py + ny, px + nx);
 			tty_puts(tty, tmp);
+			for (yy = py; yy < py + ny; yy++)
+				tty_shadow_forget(tty, px, yy, nx);
 			return;
 		}
 
@@ -1561,7 +2058,10 @@ tty_write(void (*cmdfn)(struct tty *, const struct tty_ctx *),
 				break;
 			if (state == 0)
 				continue;
-			cmdfn(&c->tty, ctx);
+			if (c->tty.flags & TTY_BLOCK)
+				tty_block_mark(&c->tty, cmdfn, ctx);
+			else
+				cmdfn(&c->tty, ctx);
 		}
 	}
 }
@@ -2013,7 +2513,9 @@ tty_cmd_cells(struct tty *tty, const struct tty_ctx *ctx)
 {
 	struct visible_ranges	*r;
 	struct visible_range	*rr;
-	u_int			 i, px, py, cx;
+	struct grid_cell	 gc;
+	u_int			 i, j, px, py, cx, sx, sy;
+	int			 flags;
 	char			*cp = ctx->ptr;
 
 	if (!tty_is_visible(tty, ctx, ctx->ocx, ctx->ocy, ctx->num, 1))
@@ -2044,13 +2546,29 @@ tty_cmd_cells(struct tty *tty, const struct tty_ctx *ctx)
 	px = ctx->xoff + ctx->ocx - ctx->wox;
 	py = ctx->yoff + ctx->ocy - ctx->woy;
 
+	tty_shadow_cell(tty, ctx->cell, &ctx->defaults, ctx->palette, &gc);
 	r = tty_check_overlay_range(tty, px, py, ctx->num);
 	for (i = 0; i < r->used; i++) {
 		rr = &r->ranges[i];
-		if (rr->nx != 0) {
-			cx = rr->px - ctx->xoff + ctx->wox;
-			tty_cursor_pane_unless_wrap(tty, ctx, cx, ctx->ocy);
+		if (rr->nx == 0)
+			continue;
+		cx = rr->px - ctx->xoff + ctx->wox;
+		tty_cursor_pane_unless_wrap(tty, ctx, cx, ctx->ocy);
+
+		/* Record the cells unless they wrap on to the next line. */
+		sx = tty->cx;
+		sy = tty->cy;
+		if (sx == UINT_MAX || sy == UINT_MAX || sx + rr->nx > tty->sx) {
 			tty_putn(tty, cp + rr->px - px, rr->nx, rr->nx);
+			continue;
+		}
+		flags = (tty->flags & TTY_SHADOWING);
+		tty->flags |= TTY_SHADOWING;
+		tty_putn(tty, cp + rr->px - px, rr->nx, rr->nx);
+		tty->flags = (tty->flags & ~TTY_SHADOWING)|flags;
+		for (j = 0; j < rr->nx; j++) {
+			utf8_set(&gc.data, cp[rr->px - px + j]);
+			tty_shadow_set(tty, sx + j, sy, &gc);
 		}
 	}
 }
@@ -2168,6 +2686,9 @@ tty_cell(struct tty *tty, const struct grid_cell *gc,
     struct hyperlinks *hl)
 {
 	const struct grid_cell	*gcp;
+	struct grid_cell	 sgc;
+	u_int			 cx = tty->cx, cy = tty->cy, i;
+	int			 flags;
 
 	/* Skip last character if terminal is stupid. */
 	if ((tty->term->flags & TERM_NOAM) &&
@@ -2184,16 +2705,30 @@ tty_cell(struct tty *tty, const struct grid_cell *gc,
 	tty_attributes(tty, gcp, defaults, palette, hl);
 
 	/* If it is a single character, write with putc to handle ACS. */
+	flags = (tty->flags & TTY_SHADOWING);
+	tty->flags |= TTY_SHADOWING;
 	if (gcp->data.size == 1) {
 		tty_attributes(tty, gcp, defaults, palette, hl);
-		if (*gcp->data.data < 0x20 || *gcp->data.data == 0x7f)
+		if (*gcp->data.data < 0x20 || *gcp->data.data == 0x7f) {
+			tty->flags = (tty->flags & ~TTY_SHADOWING)|flags;
 			return;
+		}
 		tty_putc(tty, *gcp->data.data);
-		return;
+	} else {
+		/* Write the data. */
+		tty_putn(tty, gcp->data.data, gcp->data.size,
+		    gcp->data.width);
 	}
+	tty->flags = (tty->flags & ~TTY_SHADOWING)|flags;
 
-	/* Write the data. */
-	tty_putn(tty, gcp->data.data, gcp->data.size, gcp->data.width);
+	/* Record the cell unless it wrapped on to the next line. */
+	if (cx == UINT_MAX || cy == UINT_MAX || cx + gcp->data.width > tty->sx)
+		return;
+	tty_shadow_cell(tty, gcp, defaults, palette, &sgc);
+	tty_shadow_set(tty, cx, cy, &sgc);
+	sgc.flags |= GRID_FLAG_PADDING;
+	for (i = 1; i < gcp->data.width; i++)
+		tty_shadow_set(tty, cx + i, cy, &sgc);
 }
 
 void
@@ -2210,6 +2745,7 @@ tty_reset(struct tty *tty)
 		memcpy(gc, &grid_default_cell, sizeof *gc);
 	}
 	memcpy(&tty->last_cell, &grid_default_cell, sizeof tty->last_cell);
+	tty_shadow_set_pen(tty, &grid_default_cell, &grid_default_cell, NULL);
 }
 
 void
@@ -2217,6 +2753,8 @@ tty_invalidate(struct tty *tty)
 {
 	memcpy(&tty->cell, &grid_default_cell, sizeof tty->cell);
 	memcpy(&tty->last_cell, &grid_default_cell, sizeof tty->last_cell);
+	tty_shadow_reset(tty);
+	tty_shadow_clear_pen(tty);
 
 	tty->cx = tty->cy = UINT_MAX;
 	tty->rupper = tty->rleft = UINT_MAX;
@@ -2346,12 +2884,106 @@ tty_cursor_pane(struct tty *tty, const struct tty_ctx *ctx, u_int cx, u_int cy)
 }
 
 /* Move cursor to absolute position. */
+/* Length of a capability with an argument, or 0 if it is missing. */
+static size_t
+tty_cursor_cost(struct tty *tty, enum tty_code_code code, int a)
+{
+	if (!tty_term_has(tty->term, code))
+		return (0);
+	return (strlen(tty_term_string_i(tty->term, code, a)));
+}
+
+/*
+ * Move the cursor to a column on the same line with whichever of the
+ * relative or absolute capabilities is shortest. Moving right over cells
+ * which are known to be showing plain text in the current attributes may
+ * also be done by writing the text again. Returns 0 if absolute movement
+ * should be used.
+ */
+static int
+tty_cursor_column(struct tty *tty, u_int cx)
+{
+	u_int	thisx = tty->cx, cy = tty->cy, n;
+	size_t	cost, best = SIZE_MAX;
+	int	flags, margin = tty_use_margin(tty), code = -1;
+	char	text[16];
+
+	if (cx > thisx) {
+		n = cx - thisx;
+		if (n == 1 && tty_term_has(tty->term, TTYC_CUF1)) {
+			best = strlen(tty_term_string(tty->term, TTYC_CUF1));
+			code = TTYC_CUF1;
+		}
+		cost = tty_cursor_cost(tty, TTYC_CUF, n);
+		if (!margin && cost != 0 && cost < best) {
+			best = cost;
+			code = TTYC_CUF;
+		}
+	} else {
+		n = thisx - cx;
+		if (n <= 2 && tty_term_has(tty->term, TTYC_CUB1)) {
+			best = strlen(tty_term_string(tty->term, TTYC_CUB1));
+			best *= n;
+			code = TTYC_CUB1;
+		}
+		cost = tty_cursor_cost(tty, TTYC_CUB, n);
+		if (!margin && cost != 0 && cost < best) {
+			best = cost;
+			code = TTYC_CUB;
+		}
+	}
+	cost = tty_cursor_cost(tty, TTYC_HPA, cx);
+	if (cost != 0 && cost < best) {
+		best = cost;
+		code = TTYC_HPA;
+	}
+	cost = strlen(tty_term_string_ii(tty->term, TTYC_CUP, cy, cx));
+	if (cost < best) {
+		best = cost;
+		code = -1;
+	}
+
+	if (cx > thisx &&
+	    n < best &&
+	    n <= sizeof text &&
+	    (!margin || (tty->rright != UINT_MAX && cx <= tty->rright)) &&
+	    tty_shadow_get_text(tty, thisx, cy, n, text)) {
+		log_debug("%s: writing %u cells", __func__, n);
+		flags = (tty->flags & TTY_SHADOWING);
+		tty->flags |= TTY_SHADOWING;
+		tty_putn(tty, text, n, n);
+		tty->flags = (tty->flags & ~TTY_SHADOWING)|flags;
+		return (1);
+	}
+
+	switch (code) {
+	case TTYC_CUF1:
+		tty_putcode(tty, TTYC_CUF1);
+		break;
+	case TTYC_CUB1:
+		while (n-- > 0)
+			tty_putcode(tty, TTYC_CUB1);
+		break;
+	case TTYC_CUF:
+	case TTYC_CUB:
+		tty_putcode_i(tty, code, n);
+		break;
+	case TTYC_HPA:
+		tty_putcode_i(tty, TTYC_HPA, cx);
+		break;
+	default:
+		return (0);
+	}
+	return (1);
+}
+
 void
 tty_cursor(struct tty *tty, u_int cx, u_int cy)
 {
 	struct tty_term	*term = tty->term;
 	u_int		 thisx, thisy;
 	int		 change;
+	size_t		 cost, vpa;
 
 	if (tty->flags & TTY_BLOCK)
 		return;
@@ -2404,44 +3036,8 @@ tty_cursor(struct tty *tty, u_int cx, u_int cy)
 			goto out;
 		}
 
-		/* One to the left. */
-		if (cx == thisx - 1 && tty_term_has(term, TTYC_CUB1)) {
-			tty_putcode(tty, TTYC_CUB1);
-			goto out;
-		}
-
-		/* One to the right. */
-		if (cx == thisx + 1 && tty_term_has(term, TTYC_CUF1)) {
-			tty_putcode(tty, TTYC_CUF1);
+		if (tty_cursor_column(tty, cx))
 			goto out;
-		}
-
-		/* Calculate difference. */
-		change = thisx - cx;	/* +ve left, -ve right */
-
-		/*
-		 * Use HPA if change is larger than absolute, otherwise move
-		 * the cursor with CUB/CUF.
-		 */
-		if ((u_int) abs(change) > cx && tty_term_has(term, TTYC_HPA)) {
-			tty_putcode_i(tty, TTYC_HPA, cx);
-			goto out;
-		} else if (change > 0 &&
-		    tty_term_has(term, TTYC_CUB) &&
-		    !tty_use_margin(tty)) {
-			if (change == 2 && tty_term_has(term, TTYC_CUB1)) {
-				tty_putcode(tty, TTYC_CUB1);
-				tty_putcode(tty, TTYC_CUB1);
-				goto out;
-			}
-			tty_putcode_i(tty, TTYC_CUB, change);
-			goto out;
-		} else if (change < 0 &&
-		    tty_term_has(term, TTYC_CUF) &&
-		    !tty_use_margin(tty)) {
-			tty_putcode_i(tty, TTYC_CUF, -change);
-			goto out;
-		}
 	} else if (cx == thisx) {
 		/*
 		 * Moving row only, column staying the same.
@@ -2465,10 +3061,15 @@ tty_cursor(struct tty *tty, u_int cx, u_int cy)
 		change = thisy - cy;	/* +ve up, -ve down */
 
 		/*
-		 * Try to use VPA if change is larger than absolute or if this
-		 * change would cross the scroll region, otherwise use CUU/CUD.
+		 * Try to use VPA if it is shorter or if this change would
+		 * cross the scroll region, otherwise use CUU/CUD.
 		 */
-		if ((u_int) abs(change) > cy ||
+		if (change > 0)
+			cost = tty_cursor_cost(tty, TTYC_CUU, change);
+		else
+			cost = tty_cursor_cost(tty, TTYC_CUD, -change);
+		vpa = tty_cursor_cost(tty, TTYC_VPA, cy);
+		if ((vpa != 0 && (cost == 0 || vpa < cost)) ||
 		    (change < 0 && cy - change > tty->rlower) ||
 		    (change > 0 && cy - change < tty->rupper)) {
 			    if (tty_term_has(term, TTYC_VPA)) {
@@ -2512,67 +3113,141 @@ tty_hyperlink(struct tty *tty, const struct grid_cell *gc,
 		tty_putcode_ss(tty, TTYC_HLS, id, uri);
 }
 
-void
-tty_attributes(struct tty *tty, const struct grid_cell *gc,
-    const struct grid_cell *defaults, struct colour_palette *palette,
-    struct hyperlinks *hl)
+/*
+ * Turn off attributes individually using the standard SGR sequences rather
+ * than resetting everything.
+ */
+static void
+tty_attributes_clear(struct tty *tty, const struct grid_cell *gc)
 {
-	struct grid_cell	*tc = &tty->cell, gc2;
-	int			 changed;
+	struct grid_cell	*tc = &tty->cell;
+	int			 cleared = tc->attr & ~gc->attr;
+
+	/* This turns off both bright and dim. */
+	if (cleared & (GRID_ATTR_BRIGHT|GRID_ATTR_DIM)) {
+		tty_puts(tty, "\033[22m");
+		tc->attr &= ~(GRID_ATTR_BRIGHT|GRID_ATTR_DIM);
+	}
+	if (cleared & GRID_ATTR_ITALICS)
+		tty_puts(tty, "\033[23m");
+	if (cleared & GRID_ATTR_ALL_UNDERSCORE) {
+		tty_puts(tty, "\033[24m");
+		tc->attr &= ~GRID_ATTR_ALL_UNDERSCORE;
+	}
+	if (cleared & GRID_ATTR_BLINK)
+		tty_puts(tty, "\033[25m");
+	if (cleared & GRID_ATTR_REVERSE)
+		tty_puts(tty, "\033[27m");
+	if (cleared & GRID_ATTR_HIDDEN)
+		tty_puts(tty, "\033[28m");
+	if (cleared & GRID_ATTR_STRIKETHROUGH)
+		tty_puts(tty, "\033[29m");
+	if (cleared & GRID_ATTR_OVERLINE)
+		tty_puts(tty, "\033[55m");
+	if ((cleared & GRID_ATTR_CHARSET) && tty_acs_needed(tty))
+		tty_putcode(tty, TTYC_RMACS);
+	tc->attr &= ~cleared;
+
+	if (tc->us != gc->us && gc->us == 0) {
+		tty_putcode(tty, TTYC_OL);
+		tc->us = 0;
+	}
+}
 
-	/* Copy cell and update default colours. */
-	memcpy(&gc2, gc, sizeof gc2);
-	if (~gc->flags & GRID_FLAG_NOPALETTE) {
-		if (gc2.fg == 8)
-			gc2.fg = defaults->fg;
-		if (gc2.bg == 8)
-			gc2.bg = defaults->bg;
+/* Can attributes be turned off individually rather than with a reset? */
+static int
+tty_attributes_can_clear(struct tty *tty, const struct grid_cell *gc)
+{
+	struct grid_cell	*tc = &tty->cell;
+	int			 cleared = tc->attr & ~gc->attr;
+
+	if (~tty->term->flags & TERM_SGR)
+		return (0);
+	if (cleared == 0 && (tc->us == gc->us || gc->us != 0))
+		return (0);
+	if ((cleared & GRID_ATTR_ITALICS) && !tty_use_italics(tty))
+		return (0);
+	if ((cleared & GRID_ATTR_REVERSE) && !tty_term_has(tty->term, TTYC_REV))
+		return (0);
+	if (tc->us != gc->us && gc->us == 0 &&
+	    !tty_term_has(tty->term, TTYC_OL))
+		return (0);
+	return (1);
+}
+
+/*
+ * Set attributes and colours with the SGR sequences combined. If attributes
+ * are being turned off, try both resetting everything and turning off
+ * individually and use whichever is shorter.
+ */
+static void
+tty_attributes_combine(struct tty *tty, const struct grid_cell *gc)
+{
+	struct client		*c = tty->client;
+	struct tty_sgr		 sgr1, sgr2, *sgr = &sgr1;
+	struct grid_cell	 saved, cell1;
+	int			 clear;
+
+	memcpy(&saved, &tty->cell, sizeof saved);
+	clear = tty_attributes_can_clear(tty, gc);
+
+	tty_sgr_start(tty, &sgr1);
+	tty_attributes_set(tty, gc, 1);
+	tty_sgr_flush(&sgr1);
+
+	if (clear) {
+		memcpy(&cell1, &tty->cell, sizeof cell1);
+		memcpy(&tty->cell, &saved, sizeof tty->cell);
+
+		tty_sgr_start(tty, &sgr2);
+		tty_attributes_set(tty, gc, 0);
+		tty_sgr_flush(&sgr2);
+
+		if (!sgr2.overflow && (sgr1.overflow || sgr2.used < sgr1.used))
+			sgr = &sgr2;
+		else
+			memcpy(&tty->cell, &cell1, sizeof tty->cell);
 	}
+	tty->sgr = NULL;
 
-	/* Ignore cell if it is the same as the last one. */
-	if (gc2.attr == tty->last_cell.attr &&
-	    gc2.fg == tty->last_cell.fg &&
-	    gc2.bg == tty->last_cell.bg &&
-	    gc2.us == tty->last_cell.us &&
-		gc2.link == tty->last_cell.link)
+	if (sgr->overflow) {
+		memcpy(&tty->cell, &saved, sizeof tty->cell);
+		tty_attributes_set(tty, gc, 1);
 		return;
-
-	/*
-	 * If no setab, try to use the reverse attribute as a best-effort for a
-	 * non-default background. This is a bit of a hack but it doesn't do
-	 * any serious harm and makes a couple of applications happier.
-	 */
-	if (!tty_term_has(tty->term, TTYC_SETAB)) {
-		if (gc2.attr & GRID_ATTR_REVERSE) {
-			if (gc2.fg != 7 && !COLOUR_DEFAULT(gc2.fg))
-				gc2.attr &= ~GRID_ATTR_REVERSE;
-		} else {
-			if (gc2.bg != 0 && !COLOUR_DEFAULT(gc2.bg))
-				gc2.attr |= GRID_ATTR_REVERSE;
-		}
 	}
+	if (sgr->used != 0)
+		tty_add(tty, sgr->out, sgr->used);
+	if (!sgr1.overflow && sgr1.raw > sgr->used)
+		c->sgr_saved += sgr1.raw - sgr->used;
+}
 
-	/* Fix up the colours if necessary. */
-	tty_check_fg(tty, palette, &gc2);
-	tty_check_bg(tty, palette, &gc2);
-	tty_check_us(tty, palette, &gc2);
+/* Set attributes and colours, resetting or turning off as needed. */
+static void
+tty_attributes_set(struct tty *tty, const struct grid_cell *gc, int reset)
+{
+	struct grid_cell	*tc = &tty->cell;
+	int			 changed;
 
 	/*
 	 * If any bits are being cleared or the underline colour is now default,
-	 * reset everything.
+	 * reset everything or turn them off individually.
 	 */
-	if ((tc->attr & ~gc2.attr) || (tc->us != gc2.us && gc2.us == 0))
-		tty_reset(tty);
+	if ((tc->attr & ~gc->attr) || (tc->us != gc->us && gc->us == 0)) {
+		if (reset)
+			tty_reset(tty);
+		else
+			tty_attributes_clear(tty, gc);
+	}
 
 	/*
 	 * Set the colours. This may call tty_reset() (so it comes next) and
 	 * may add to (NOT remove) the desired attributes.
 	 */
-	tty_colours(tty, &gc2);
+	tty_colours(tty, gc);
 
 	/* Filter out attribute bits already set. */
-	changed = gc2.attr & ~tc->attr;
-	tc->attr = gc2.attr;
+	changed = gc->attr & ~tc->attr;
+	tc->attr = gc->attr;
 
 	/* Set the attributes. */
 	if (changed & GRID_ATTR_BRIGHT)
@@ -2609,11 +3284,67 @@ tty_attributes(struct tty *tty, const struct grid_cell *gc,
 		tty_putcode(tty, TTYC_SMOL);
 	if ((changed & GRID_ATTR_CHARSET) && tty_acs_needed(tty))
 		tty_putcode(tty, TTYC_SMACS);
+}
+
+void
+tty_attributes(struct tty *tty, const struct grid_cell *gc,
+    const struct grid_cell *defaults, struct colour_palette *palette,
+    struct hyperlinks *hl)
+{
+	struct grid_cell	gc2;
+
+	/* Copy cell and update default colours. */
+	memcpy(&gc2, gc, sizeof gc2);
+	if (~gc->flags & GRID_FLAG_NOPALETTE) {
+		if (gc2.fg == 8)
+			gc2.fg = defaults->fg;
+		if (gc2.bg == 8)
+			gc2.bg = defaults->bg;
+	}
+
+	/* Ignore cell if it is the same as the last one. */
+	if (gc2.attr == tty->last_cell.attr &&
+	    gc2.fg == tty->last_cell.fg &&
+	    gc2.bg == tty->last_cell.bg &&
+	    gc2.us == tty->last_cell.us &&
+		gc2.link == tty->last_cell.link)
+		return;
+
+	/*
+	 * If no setab, try to use the reverse attribute as a best-effort for a
+	 * non-default background. This is a bit of a hack but it doesn't do
+	 * any serious harm and makes a couple of applications happier.
+	 */
+	if (!tty_term_has(tty->term, TTYC_SETAB)) {
+		if (gc2.attr & GRID_ATTR_REVERSE) {
+			if (gc2.fg != 7 && !COLOUR_DEFAULT(gc2.fg))
+				gc2.attr &= ~GRID_ATTR_REVERSE;
+		} else {
+			if (gc2.bg != 0 && !COLOUR_DEFAULT(gc2.bg))
+				gc2.attr |= GRID_ATTR_REVERSE;
+		}
+	}
+
+	/* Fix up the colours if necessary. */
+	tty_check_fg(tty, palette, &gc2);
+	tty_check_bg(tty, palette, &gc2);
+	tty_check_us(tty, palette, &gc2);
+
+	/*
+	 * Set the attributes and colours. If the terminal supports SGR, the
+	 * sequences are combined and the shorter of resetting everything or
+	 * turning off only what needs to be is chosen.
+	 */
+	if (tty->term->flags & TERM_VT100LIKE)
+		tty_attributes_combine(tty, &gc2);
+	else
+		tty_attributes_set(tty, &gc2, 1);
 
 	/* Set hyperlink if any. */
 	tty_hyperlink(tty, gc, hl);
 
 	memcpy(&tty->last_cell, &gc2, sizeof tty->last_cell);
+	tty_shadow_set_pen(tty, gc, defaults, palette);
 }
 
 static void
@@ -2903,7 +3634,7 @@ tty_colours_us(struct tty *tty, const struct grid_cell *gc)
 		if ((~c & COLOUR_FLAG_256) && (c >= 90 && c <= 97))
 			c -= 82;
 		tty_putcode_i(tty, TTYC_SETULC1, c & ~COLOUR_FLAG_256);
-		return;
+		goto save;
 	}
 
 	/*
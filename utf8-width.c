@@ -0,0 +1,1897 @@
+/* $OpenBSD$ */
+
+/*
+ * Copyright (c) 2026 The tmux authors
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF MIND, USE, DATA OR PROFITS, WHETHER
+ * IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING
+ * OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/* Generated by tools/utf8-width.py from Unicode 14.0.0. Do not edit. */
+
+#include <sys/types.h>
+
+#include "tmux.h"
+
+/* Version of Unicode the table was generated from. */
+const char *utf8_table_version = "14.0.0";
+
+/*
+ * Widths of each Unicode codepoint, two bits each. The block for a codepoint
+ * is found from its top bits in utf8_width_index and the width from the bottom
+ * eight bits in that block of utf8_width_blocks. A width of three means the
+ * codepoint is not assigned in this version of Unicode.
+ */
+static const u_char utf8_width_index[4352] = {
+	  0,   1,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,
+	 11,  12,  13,  14,  15,  16,  17,  18,   1,   1,  19,  20,
+	 21,  22,  23,  24,  25,  26,   1,  27,  28,  29,   1,  30,
+	 31,  32,  33,  34,   1,   1,   1,  35,  36,  37,  38,  39,
+	 40,  41,  42,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  44,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  45,   1,  46,  47,
+	 48,  49,  50,  51,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  52,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,  43,  53,  54,
+	  1,  55,  56,  57,  58,  59,  60,  61,  62,  63,   1,  64,
+	 65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,
+	 77,  78,  79,  80,  81,  82,  83,  84,  85,  86,  87,  88,
+	  1,   1,   1,  89,  90,  91,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  92,   1,   1,   1,   1,  93,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	  1,   1,  94,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	  1,   1,  95,  96,  84,  84,  97,  98,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  99,  43,  43,  43,  43,
+	100, 101,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84, 102,
+	 43, 103, 104,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	105,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84, 106, 107, 108, 109, 110,
+	111, 112, 113, 114,   1,   1, 115,  84,  84,  84,  84, 116,
+	117, 118, 119,  84,  84,  84,  84, 120, 121, 122,  84,  84,
+	123, 124, 125,  84, 126, 127, 128, 129, 130, 131, 132, 133,
+	134, 135, 136, 137,  84,  84,  84,  84,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43, 138,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43, 139,
+	140,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43, 141,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43, 142,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  43,  43, 143,  84,  84,  84,  84,  84,
+	 43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,  43,
+	 43,  43,  43,  43,  43,  43,  43, 144,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84, 145, 146,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	 84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,  84,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1, 147,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1, 147
+};
+
+static const u_char utf8_width_blocks[148][64] = {
+	{ /* 0 */
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 1 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 2 */
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x5f, 0x55,
+		0xff, 0x55, 0xd5, 0x5d, 0x55, 0x55, 0x55, 0x55,
+		0x75, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 3 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x15, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 4 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x57, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x57, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xd5, 0x57, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+		0x41, 0x10, 0xff, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xd5, 0x7f, 0x55, 0xfd, 0xff, 0xff
+	},
+	{ /* 5 */
+		0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x40, 0x54,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x14,
+		0x00, 0x14, 0x04, 0x50, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 6 */
+		0x55, 0x55, 0x55, 0x75, 0x51, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xc0, 0x57, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x05, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0xd5, 0x53
+	},
+	{ /* 7 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x10, 0x00,
+		0x00, 0x01, 0x01, 0xf0, 0x55, 0x55, 0x55, 0xd5,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0xdf,
+		0x55, 0x55, 0xd5, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xd5, 0xf5, 0xff, 0x00, 0x00,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	},
+	{ /* 8 */
+		0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x54,
+		0x01, 0x00, 0x54, 0x51, 0x01, 0x00, 0x55, 0x55,
+		0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x51, 0x57, 0x55, 0x7d, 0x7d, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x5d, 0x55, 0xdd, 0x5f, 0xf5, 0x54,
+		0x01, 0x7c, 0x7d, 0xd1, 0xff, 0x7f, 0xff, 0x75,
+		0x05, 0x5f, 0x55, 0x55, 0x55, 0x55, 0x55, 0xc5
+	},
+	{ /* 9 */
+		0x43, 0x57, 0xd5, 0x7f, 0x7d, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x5d, 0x55, 0x5d, 0xd7, 0xf5, 0x5c,
+		0xc1, 0x3f, 0x3c, 0xf0, 0xf3, 0xff, 0x57, 0xdd,
+		0xff, 0x5f, 0x55, 0x55, 0x50, 0xd1, 0xff, 0xff,
+		0x43, 0x57, 0x55, 0x75, 0x75, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x5d, 0x55, 0x5d, 0x57, 0xf5, 0x54,
+		0x01, 0x30, 0x74, 0xf1, 0xfd, 0xff, 0xff, 0xff,
+		0x05, 0x5f, 0x55, 0x55, 0xf5, 0xff, 0x07, 0x00
+	},
+	{ /* 10 */
+		0x53, 0x57, 0x55, 0x7d, 0x7d, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x5d, 0x55, 0x5d, 0x57, 0xf5, 0x14,
+		0x01, 0x7c, 0x7d, 0xf1, 0xff, 0x43, 0xff, 0x75,
+		0x05, 0x5f, 0x55, 0x55, 0x55, 0x55, 0xff, 0xff,
+		0x4f, 0x57, 0xd5, 0x5f, 0x5d, 0xf5, 0xd7, 0x5d,
+		0x7f, 0xfd, 0xd5, 0x5f, 0x55, 0x55, 0xf5, 0x5f,
+		0xd4, 0x5f, 0x5d, 0xf1, 0xfd, 0x7f, 0xff, 0xff,
+		0xff, 0x5f, 0x55, 0x55, 0x55, 0x55, 0xd5, 0xff
+	},
+	{ /* 11 */
+		0x54, 0x54, 0x55, 0x5d, 0x5d, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x5d, 0x55, 0x55, 0x55, 0xf5, 0x04,
+		0x54, 0x0d, 0x0c, 0xf0, 0xff, 0xc3, 0xd5, 0xf7,
+		0x05, 0x5f, 0x55, 0x55, 0xff, 0x7f, 0x55, 0x55,
+		0x51, 0x55, 0x55, 0x5d, 0x5d, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x5d, 0x55, 0x55, 0x57, 0xf5, 0x14,
+		0x55, 0x4d, 0x5d, 0xf0, 0xff, 0xd7, 0xff, 0xd7,
+		0x05, 0x5f, 0x55, 0x55, 0xd7, 0xff, 0xff, 0xff
+	},
+	{ /* 12 */
+		0x50, 0x55, 0x55, 0x5d, 0x5d, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54,
+		0x01, 0x5c, 0x5d, 0x51, 0xff, 0x55, 0x55, 0x55,
+		0x05, 0x5f, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x53, 0x57, 0x55, 0x55, 0x55, 0xd5, 0x5f, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x75, 0x55, 0x55, 0xf7,
+		0x55, 0xd5, 0xcf, 0x7f, 0x05, 0xcc, 0x55, 0x55,
+		0xff, 0x5f, 0x55, 0x55, 0x5f, 0xfd, 0xff, 0xff
+	},
+	{ /* 13 */
+		0x57, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x51, 0x00, 0xc0, 0x7f,
+		0x55, 0x15, 0x00, 0x40, 0x55, 0x55, 0x55, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xd7, 0x5d, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x77, 0x55, 0x55, 0x51, 0x00, 0x00, 0xf4,
+		0x55, 0xdd, 0x00, 0xf0, 0x55, 0x55, 0xf5, 0x55,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 14 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x11, 0x51, 0x55,
+		0x55, 0x55, 0x57, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xfd, 0x03, 0x00, 0x00, 0x40,
+		0x00, 0x04, 0x55, 0x01, 0x00, 0x00, 0x03, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c,
+		0x55, 0x45, 0x55, 0x5d, 0x55, 0x55, 0xd5, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 15 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x01, 0x04, 0x00, 0x41, 0x41,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05,
+		0x54, 0x55, 0x55, 0x55, 0x01, 0x54, 0x55, 0x55,
+		0x45, 0x41, 0x55, 0x51, 0x55, 0x55, 0x55, 0x51,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x75, 0xff, 0xf7, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 16 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	},
+	{ /* 17 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x5d, 0xf5, 0x55, 0xd5, 0x5d, 0xf5,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x5d, 0xf5, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x5d, 0xf5, 0x55, 0xd5,
+		0x5d, 0xf5, 0x55, 0x55, 0x55, 0xd5, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 18 */
+		0x55, 0x55, 0x55, 0x55, 0x5d, 0xf5, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x03,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xfd,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xf5, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xf5, 0x55, 0xf5
+	},
+	{ /* 19 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xfd,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xfd, 0xff
+	},
+	{ /* 20 */
+		0x55, 0x55, 0x55, 0x55, 0x05, 0xf4, 0xff, 0x7f,
+		0x55, 0x55, 0x55, 0x55, 0x05, 0xd5, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x05, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x5d, 0x0d, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x10, 0x00, 0x50,
+		0x55, 0x45, 0x01, 0x00, 0x00, 0x55, 0x55, 0xf1,
+		0x55, 0x55, 0xf5, 0xff, 0x55, 0x55, 0xf5, 0xff
+	},
+	{ /* 21 */
+		0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0xf5, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xfd, 0xff,
+		0x55, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xd1, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xf5, 0xff, 0xff
+	},
+	{ /* 22 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5,
+		0x40, 0x15, 0x54, 0xff, 0x45, 0x55, 0x01, 0xff,
+		0xfd, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xf5, 0x55, 0xfd, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xf5, 0xff, 0x55, 0x55, 0xd5, 0x5f,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 23 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x14, 0x5f,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x00, 0xc0,
+		0x44, 0x01, 0x00, 0x54, 0x15, 0x00, 0x00, 0x3c,
+		0x55, 0x55, 0xf5, 0xff, 0x55, 0x55, 0xf5, 0xff,
+		0x55, 0x55, 0x55, 0xf5, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 24 */
+		0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x04, 0x40, 0x54,
+		0x45, 0x55, 0x55, 0xfd, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0xd5,
+		0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x05, 0x50, 0x10, 0x50, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x45, 0x50, 0x11, 0x50, 0xff, 0xff, 0x55
+	},
+	{ /* 25 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x00, 0x00, 0x05, 0x7f, 0x55,
+		0x55, 0x55, 0xf5, 0x57, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xfd, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x57,
+		0x55, 0x55, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00,
+		0x04, 0x00, 0x54, 0x51, 0x55, 0x54, 0xd0, 0xff
+	},
+	{ /* 26 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	},
+	{ /* 27 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xf5, 0x55, 0xf5,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0xf5, 0x55, 0xf5, 0x55, 0x55, 0x77, 0x77,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xf5,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x55, 0x55,
+		0x55, 0x5d, 0x55, 0x55, 0x55, 0x5f, 0x55, 0x57,
+		0x55, 0x55, 0x55, 0x55, 0x5f, 0x5d, 0x55, 0xd5
+	},
+	{ /* 28 */
+		0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x00, 0x0c, 0x00, 0x00, 0xf5, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xd5, 0x55, 0x55, 0x55, 0xfd,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0xfd, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff
+	},
+	{ /* 29 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 30 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x55,
+		0x55, 0x55, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xa9, 0x56, 0x96, 0x55, 0x55, 0x55
+	},
+	{ /* 31 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 32 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x69
+	},
+	{ /* 33 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+		0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55,
+		0x59, 0x55, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x69,
+		0x55, 0x5a, 0x55, 0x65, 0x55, 0x56, 0x55, 0x55,
+		0x55, 0x55, 0x65, 0x55, 0xa5, 0x59, 0x65, 0x59
+	},
+	{ /* 34 */
+		0x55, 0x59, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x66, 0x95, 0x9a, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x95,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 35 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x56, 0x59, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x5f, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 36 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x15, 0x50, 0xff, 0x57, 0x55
+	},
+	{ /* 37 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x75, 0xff, 0xf7, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xff, 0x7f, 0xfd, 0xff, 0xff, 0x3f,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0xff, 0xff,
+		0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5,
+		0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+	},
+	{ /* 38 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xf5,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xba, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xff
+	},
+	{ /* 39 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xfa, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xff
+	},
+	{ /* 40 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0x0a, 0xa0, 0xaa, 0xaa, 0xaa, 0x6a,
+		0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xea, 0x83, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa
+	},
+	{ /* 41 */
+		0xff, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xea, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xaa
+	},
+	{ /* 42 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xea,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa
+	},
+	{ /* 43 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa
+	},
+	{ /* 44 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 45 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xfe, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xea, 0xff, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 46 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x15, 0x40, 0x00, 0x00, 0x50,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0xff, 0xff
+	},
+	{ /* 47 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xd5, 0xff, 0x75, 0x57, 0xf5, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0x5f, 0x55, 0x55, 0x55
+	},
+	{ /* 48 */
+		0x45, 0x45, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x41, 0x55, 0xfc, 0x55, 0x55, 0xf5, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0xf0, 0xff, 0x5f, 0x55, 0x55, 0xf5, 0xff,
+		0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x15
+	},
+	{ /* 49 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x05, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x15, 0x00, 0x00, 0x50, 0xff, 0xff, 0x7f,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xfe,
+		0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x15, 0x05, 0x50, 0x50,
+		0x55, 0x55, 0x55, 0x75, 0x55, 0x55, 0xf5, 0x5f,
+		0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5
+	},
+	{ /* 50 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x01, 0x40, 0x41, 0xc1, 0xff, 0xff,
+		0x15, 0x55, 0x55, 0xf4, 0x55, 0x55, 0xf5, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x04, 0x14, 0x54, 0x05,
+		0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x55,
+		0x55, 0x55, 0x55, 0x50, 0x55, 0xc5, 0xff, 0xff
+	},
+	{ /* 51 */
+		0x57, 0xd5, 0x57, 0xd5, 0x57, 0xd5, 0xff, 0xff,
+		0x55, 0xd5, 0x55, 0xd5, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x51, 0x54, 0xf1, 0x55, 0x55, 0xf5, 0xff
+	},
+	{ /* 52 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xc0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff
+	},
+	{ /* 53 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xfa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xfa, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 54 */
+		0x55, 0xd5, 0xff, 0xff, 0x7f, 0x55, 0xff, 0x47,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xdd,
+		0x75, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0xd5, 0xff, 0xff, 0xff, 0x7f, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 55 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x5f, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 56 */
+		0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xfa, 0xff,
+		0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xea, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xea, 0xaa, 0xff, 0x55, 0x5d, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x3d
+	},
+	{ /* 57 */
+		0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5,
+		0x5f, 0x55, 0x5f, 0x55, 0x5f, 0x55, 0x5f, 0xfd,
+		0xaa, 0xea, 0x55, 0xd5, 0xff, 0xff, 0x03, 0xf5
+	},
+	{ /* 58 */
+		0x55, 0x55, 0x55, 0x57, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0xd5, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x75,
+		0x55, 0x55, 0x55, 0xf5, 0x55, 0x55, 0x55, 0xf5,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0xff
+	},
+	{ /* 59 */
+		0xd5, 0x7f, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x7f, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xd5, 0x55, 0x55, 0x55, 0xfd,
+		0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xf1
+	},
+	{ /* 60 */
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xfd,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0xfd, 0xff, 0xff, 0xff,
+		0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xff
+	},
+	{ /* 61 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0xff, 0xff, 0x57, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xd5, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0xc0, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0xff, 0x55, 0x55, 0x55, 0xf5, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 62 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xf5,
+		0x55, 0x55, 0xf5, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xff, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xff
+	},
+	{ /* 63 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xff, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0xff, 0xff, 0x7f, 0x55, 0x55, 0xd5, 0x55,
+		0x55, 0x55, 0xd5, 0x55, 0xd5, 0x75, 0x55, 0x55,
+		0x75, 0x55, 0x55, 0x55, 0x75, 0x55, 0x75, 0xfd,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 64 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xf5, 0xff, 0xff,
+		0x55, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x75, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x5d, 0x55, 0xd5, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 65 */
+		0x55, 0xf5, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0xfd, 0x7d,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5,
+		0xff, 0x7f, 0x55, 0x55, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0xd5, 0xf5, 0x7f, 0x55
+	},
+	{ /* 66 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7f,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xf5, 0x7f,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xff, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x5f, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 67 */
+		0x01, 0xc3, 0xff, 0x00, 0x55, 0x57, 0x57, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xf5, 0xc0, 0x3f,
+		0x55, 0x55, 0xfd, 0xff, 0x55, 0x55, 0xfd, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0xc1, 0x7f, 0x55, 0x55, 0xd5, 0xff, 0xff
+	},
+	{ /* 68 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xf5, 0x57, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xf5, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0xd5, 0xff, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0xf5, 0xff, 0x57, 0xfd,
+		0xff, 0xff, 0x57, 0x55, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 69 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0xd5, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0xd5, 0xff, 0x5f, 0x55
+	},
+	{ /* 70 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x00, 0xff, 0xff, 0x55, 0x55, 0xf5, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 71 */
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x35, 0xf4, 0xf5, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 72 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xff, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x05, 0x00, 0x00, 0x54, 0x55, 0xf5, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x05, 0x50, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0xff, 0xff
+	},
+	{ /* 73 */
+		0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+		0x00, 0x40, 0x55, 0xf5, 0x5f, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x14, 0xf4, 0xff, 0x3f,
+		0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x15, 0x40, 0x41, 0x55,
+		0xc5, 0xff, 0xff, 0xf7, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xfd, 0xff, 0x55, 0x55, 0xf5, 0xff
+	},
+	{ /* 74 */
+		0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x15, 0x00, 0x01, 0x00, 0x5c, 0x55, 0x55,
+		0x55, 0x55, 0xff, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x15, 0xd5, 0xff, 0xff,
+		0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x40,
+		0x55, 0x55, 0x01, 0x14, 0x55, 0x55, 0x55, 0x55,
+		0x57, 0x55, 0x55, 0x55, 0x55, 0xfd, 0xff, 0xff
+	},
+	{ /* 75 */
+		0x55, 0x55, 0x55, 0x55, 0x75, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x15, 0x50, 0x04, 0x55, 0xc5,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0xd5, 0x5d, 0x75, 0x55, 0x55, 0x55, 0x75,
+		0x55, 0x55, 0xf5, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+		0x15, 0x00, 0xc0, 0xff, 0x55, 0x55, 0xf5, 0xff
+	},
+	{ /* 76 */
+		0x50, 0x57, 0x55, 0x7d, 0x7d, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x5d, 0x55, 0x5d, 0x57, 0x35, 0x54,
+		0x54, 0x7d, 0x7d, 0xf5, 0xfd, 0x7f, 0xff, 0x57,
+		0x55, 0x0f, 0x00, 0xfc, 0x00, 0xfc, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 77 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+		0x05, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x47,
+		0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x44, 0x15,
+		0x04, 0x55, 0xff, 0xff, 0x55, 0x55, 0xf5, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 78 */
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x05, 0xf0, 0x55, 0x10,
+		0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xf0,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 79 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x40, 0x11,
+		0x54, 0xfd, 0xff, 0xff, 0x55, 0x55, 0xf5, 0xff,
+		0x55, 0x55, 0x55, 0xfd, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x15, 0x51, 0x00, 0x10, 0xf5, 0xff,
+		0x55, 0x55, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 80 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x03,
+		0x05, 0x10, 0x00, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 81 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x41, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0xd5, 0xff, 0xff, 0x7f
+	},
+	{ /* 82 */
+		0x55, 0xd5, 0xf7, 0x55, 0x55, 0xd7, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0x3d, 0x44,
+		0x15, 0xd5, 0xff, 0xff, 0x55, 0x55, 0xf5, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x5f, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x0f, 0x55,
+		0x54, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 83 */
+		0x01, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x14, 0x40,
+		0x55, 0x15, 0xff, 0xff, 0x01, 0x40, 0x01, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x05, 0x00, 0x00, 0x40, 0x50, 0x55,
+		0xd5, 0xff, 0xff, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xfd, 0xff
+	},
+	{ /* 84 */
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 85 */
+		0x55, 0x55, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x00, 0xc0, 0x00, 0x10,
+		0x55, 0xf5, 0xff, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xfd, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x0f, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x07, 0x00, 0x04, 0xc1, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 86 */
+		0x55, 0xd5, 0x75, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x01, 0xc0, 0xcf, 0x30,
+		0x00, 0x10, 0xff, 0xff, 0x55, 0x55, 0xf5, 0xff,
+		0x55, 0x75, 0x5d, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xd5, 0x70, 0x11, 0xfd, 0xff,
+		0x55, 0x55, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 87 */
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x15, 0x54, 0xfd, 0xff
+	},
+	{ /* 88 */
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0xf5, 0xff, 0xff, 0x7f
+	},
+	{ /* 89 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xf5, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 90 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xd5, 0x55, 0xfd, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 91 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 92 */
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0xd5, 0xff, 0xff, 0xff
+	},
+	{ /* 93 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xd5, 0x00, 0x00, 0xfc, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 94 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 95 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xfd, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5,
+		0x55, 0x55, 0xf5, 0x5f, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5,
+		0x55, 0x55, 0xf5, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xf5, 0x00, 0xf4, 0xff, 0xff
+	},
+	{ /* 96 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0x55, 0x55,
+		0x55, 0xf5, 0xff, 0xff, 0x55, 0x55, 0x75, 0x55,
+		0x75, 0x55, 0x55, 0x55, 0x55, 0x55, 0xff, 0x57,
+		0x55, 0x55, 0x55, 0x55, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 97 */
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 98 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xd5, 0x3f, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xff, 0x3f, 0x40, 0x55, 0x55, 0x55,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xaa, 0xfc, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff
+	},
+	{ /* 99 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xff, 0xff
+	},
+	{ /* 100 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xfa, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 101 */
+		0xaa, 0xaa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 102 */
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xaa, 0xab, 0xaa, 0xeb
+	},
+	{ /* 103 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xea, 0xff, 0xff, 0xff,
+		0xff, 0xaa, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa
+	},
+	{ /* 104 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xff
+	},
+	{ /* 105 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xd5, 0xff, 0x55, 0x55, 0x55, 0xfd,
+		0x55, 0x55, 0xfd, 0xff, 0x55, 0x55, 0xf5, 0x41,
+		0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 106 */
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xc0, 0xff, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 107 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xf5, 0xff, 0xff
+	},
+	{ /* 108 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0xd5, 0x57, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x15, 0x50, 0x55, 0x15, 0x00, 0x00, 0x00,
+		0x40, 0x01, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x05, 0x50, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 109 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x05, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xff, 0xff, 0xff
+	},
+	{ /* 110 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xfd, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 111 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5d,
+		0xdf, 0xd7, 0x57, 0x5d, 0x55, 0x55, 0x75, 0x57,
+		0x55, 0x57, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 112 */
+		0x55, 0x75, 0xd5, 0x57, 0x55, 0x5d, 0x55, 0x5d,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0xd5,
+		0x55, 0xdd, 0x5f, 0x55, 0x5d, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 113 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0xf5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 114 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x5f, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 115 */
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x54, 0x55, 0x51, 0x55, 0x55,
+		0x55, 0x54, 0x55, 0xff, 0xff, 0xff, 0x3f, 0x00,
+		0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 116 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 117 */
+		0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00,
+		0x30, 0x0c, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 118 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xfd, 0x00, 0x40, 0x55, 0xf5,
+		0x55, 0x55, 0xf5, 0x5f, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 119 */
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xc5, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x00, 0x55, 0x55, 0xf5, 0x7f
+	},
+	{ /* 120 */
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x55, 0xd5, 0x55, 0xd7, 0x55, 0x55, 0x55, 0xd5
+	},
+	{ /* 121 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x7d, 0x55, 0x55, 0x00, 0xc0, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 122 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x00, 0x40, 0xff, 0x55, 0x55, 0xf5, 0x5f,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 123 */
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0x57, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xfd, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 124 */
+		0x57, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xf5,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 125 */
+		0x55, 0x57, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0xd7, 0x7d, 0x57, 0x55, 0xd5, 0x55, 0x77, 0xff,
+		0xdf, 0x7f, 0x77, 0x57, 0xd7, 0x7d, 0x77, 0x77,
+		0xd7, 0x7d, 0xd5, 0x55, 0xd5, 0x55, 0x57, 0xdd,
+		0x55, 0x55, 0x75, 0x55, 0x55, 0x55, 0x55, 0xff,
+		0x57, 0x57, 0x75, 0x55, 0x55, 0x55, 0x55, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff
+	},
+	{ /* 126 */
+		0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0xd5, 0x57, 0x55, 0x55, 0x55,
+		0x57, 0x55, 0x55, 0x95, 0x57, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xf5, 0xff, 0xff
+	},
+	{ /* 127 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x65, 0xa9, 0xaa, 0x6a, 0x55,
+		0x55, 0x55, 0x55, 0xf5, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0x5f, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+	},
+	{ /* 128 */
+		0xea, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xff,
+		0xaa, 0xaa, 0xfe, 0xff, 0xfa, 0xff, 0xff, 0xff,
+		0xaa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 129 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0x56, 0x55, 0x55, 0xa9, 0xaa, 0x9a, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0x6a, 0x95, 0xaa, 0x55, 0x55, 0x55,
+		0xaa, 0xaa, 0xaa, 0xaa, 0x56, 0x56, 0xaa, 0xaa
+	},
+	{ /* 130 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a,
+		0xa6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x96
+	},
+	{ /* 131 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x5a,
+		0x55, 0x55, 0x95, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x69, 0x55, 0x55,
+		0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xaa
+	},
+	{ /* 132 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0x5a, 0x55, 0x56, 0x6a, 0xa9, 0xff, 0xab,
+		0x55, 0x55, 0x95, 0xfe, 0x55, 0xaa, 0xaa, 0xfe
+	},
+	{ /* 133 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xfd, 0xff,
+		0xaa, 0xaa, 0xaa, 0xff, 0xfe, 0xff, 0xff, 0xff
+	},
+	{ /* 134 */
+		0x55, 0x55, 0x55, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xff, 0xff, 0x55, 0x55, 0xf5, 0xff,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xff, 0xff, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xf5, 0xf5, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 135 */
+		0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0xaa,
+		0xaa, 0x9a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa
+	},
+	{ /* 136 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xff, 0xff, 0xff,
+		0x55, 0x55, 0x55, 0xf5, 0xaa, 0xfe, 0xaa, 0xfe,
+		0xaa, 0xea, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xfe, 0xaa, 0xaa, 0xea, 0xff,
+		0xaa, 0xfa, 0xff, 0xff, 0xaa, 0xaa, 0xfa, 0xff,
+		0xaa, 0xaa, 0xff, 0xff, 0xaa, 0xea, 0xff, 0xff
+	},
+	{ /* 137 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0xf5, 0xff
+	},
+	{ /* 138 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 139 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xfe, 0xff,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa
+	},
+	{ /* 140 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xfa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa
+	},
+	{ /* 141 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xfa, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa
+	},
+	{ /* 142 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 143 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xfa,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 144 */
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 145 */
+		0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 146 */
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff
+	},
+	{ /* 147 */
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xf5
+	}
+};
+
+/* Look up the width of a codepoint, or -1 if it is not assigned. */
+int
+utf8_table_width(wchar_t wc)
+{
+	u_int	block, cp = wc, width;
+
+	if (wc < 0 || cp >= 0x110000)
+		return (-1);
+	block = utf8_width_index[cp >> 8];
+	width = utf8_width_blocks[block][(cp & 0xff) >> 2];
+	width = (width >> ((cp & 3) * 2)) & 3;
+	if (width == 3)
+		return (-1);
+	return (width);
+}
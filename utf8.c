@@ -28,27 +28,18 @@
 #include "tmux.h"
 
 struct utf8_width_item {
-	wchar_t				wc;
-	u_int				width;
-	int				allocated;
-
-	RB_ENTRY(utf8_width_item)	entry;
+	wchar_t		wc;
+	u_int		width;
 };
 
-static int
-utf8_width_cache_cmp(struct utf8_width_item *uw1, struct utf8_width_item *uw2)
-{
-	if (uw1->wc < uw2->wc)
-		return (-1);
-	if (uw1->wc > uw2->wc)
-		return (1);
-	return (0);
-}
-RB_HEAD(utf8_width_cache, utf8_width_item);
-RB_GENERATE_STATIC(utf8_width_cache, utf8_width_item, entry,
-    utf8_width_cache_cmp);
-static struct utf8_width_cache utf8_width_cache =
-    RB_INITIALIZER(utf8_width_cache);
+/*
+ * Widths which differ from the table, from utf8_default_width_cache and the
+ * codepoint-widths option, sorted by codepoint. Each block of 256 codepoints
+ * with any entries is marked so others do not need to be searched for.
+ */
+static struct utf8_width_item	*utf8_width_cache;
+static u_int			 utf8_width_cache_size;
+static u_char			 utf8_width_cache_blocks[0x110000 >> 8];
 
 static struct utf8_width_item utf8_default_width_cache[] = {
 	{ .wc = 0x0261D, .width = 2 },
@@ -215,40 +206,19 @@ static struct utf8_width_item utf8_default_width_cache[] = {
 	{ .wc = 0x1FAF8, .width = 2 }
 };
 
+/*
+ * Characters of more than three bytes are stored in a list and referred to by
+ * their index in it. A hash table of indexes (plus one, so zero is empty) using
+ * linear probing finds the index for some data.
+ */
 struct utf8_item {
-	RB_ENTRY(utf8_item)	index_entry;
-	u_int			index;
-
-	RB_ENTRY(utf8_item)	data_entry;
 	char			data[UTF8_SIZE];
 	u_char			size;
 };
-
-static int
-utf8_data_cmp(struct utf8_item *ui1, struct utf8_item *ui2)
-{
-	if (ui1->size < ui2->size)
-		return (-1);
-	if (ui1->size > ui2->size)
-		return (1);
-	return (memcmp(ui1->data, ui2->data, ui1->size));
-}
-RB_HEAD(utf8_data_tree, utf8_item);
-RB_GENERATE_STATIC(utf8_data_tree, utf8_item, data_entry, utf8_data_cmp);
-static struct utf8_data_tree utf8_data_tree = RB_INITIALIZER(utf8_data_tree);
-
-static int
-utf8_index_cmp(struct utf8_item *ui1, struct utf8_item *ui2)
-{
-	if (ui1->index < ui2->index)
-		return (-1);
-	if (ui1->index > ui2->index)
-		return (1);
-	return (0);
-}
-RB_HEAD(utf8_index_tree, utf8_item);
-RB_GENERATE_STATIC(utf8_index_tree, utf8_item, index_entry, utf8_index_cmp);
-static struct utf8_index_tree utf8_index_tree = RB_INITIALIZER(utf8_index_tree);
+static struct utf8_item	*utf8_list;
+static u_int		 utf8_list_size;
+static u_int		*utf8_hash;
+static u_int		 utf8_hash_size;
 
 static int	utf8_no_width;
 static u_int	utf8_next_index;
@@ -259,27 +229,78 @@ static u_int	utf8_next_index;
 #define UTF8_SET_SIZE(size) (((utf8_char)(size)) << 24)
 #define UTF8_SET_WIDTH(width) ((((utf8_char)(width)) + 1) << 29)
 
-/* Get a UTF-8 item from data. */
-static struct utf8_item *
-utf8_item_by_data(const u_char *data, size_t size)
+/* Hash UTF-8 data. */
+static u_int
+utf8_hash_data(const u_char *data, size_t size)
 {
-	struct utf8_item	ui;
-
-	memcpy(ui.data, data, size);
-	ui.size = size;
+	u_int	h = 2166136261U;
+	size_t	i;
 
-	return (RB_FIND(utf8_data_tree, &utf8_data_tree, &ui));
+	for (i = 0; i < size; i++)
+		h = (h ^ data[i]) * 16777619U;
+	return (h);
 }
 
 /* Get a UTF-8 item from data. */
+static u_int *
+utf8_item_by_data(const u_char *data, size_t size)
+{
+	struct utf8_item	*ui;
+	u_int			 mask = utf8_hash_size - 1, *slot, h;
+
+	h = utf8_hash_data(data, size);
+	for (;;) {
+		slot = &utf8_hash[h & mask];
+		if (*slot == 0)
+			return (slot);
+		ui = &utf8_list[*slot - 1];
+		if (ui->size == size && memcmp(ui->data, data, size) == 0)
+			return (slot);
+		h++;
+	}
+}
+
+/* Get a UTF-8 item from index. */
 static struct utf8_item *
 utf8_item_by_index(u_int index)
 {
-	struct utf8_item	ui;
+	if (index >= utf8_next_index)
+		return (NULL);
+	return (&utf8_list[index]);
+}
+
+/* Make the hash table bigger and rehash the items. */
+static void
+utf8_grow_hash(void)
+{
+	struct utf8_item	*ui;
+	u_int			 i, *slot;
+
+	free(utf8_hash);
+	if (utf8_hash_size == 0)
+		utf8_hash_size = 256;
+	else
+		utf8_hash_size *= 2;
+	utf8_hash = xcalloc(utf8_hash_size, sizeof *utf8_hash);
 
-	ui.index = index;
+	for (i = 0; i < utf8_next_index; i++) {
+		ui = &utf8_list[i];
+		slot = utf8_item_by_data(ui->data, ui->size);
+		*slot = i + 1;
+	}
+}
+
+/* Compare codepoints in the cache. */
+static int
+utf8_width_cache_cmp(const void *a, const void *b)
+{
+	const struct utf8_width_item	*uw1 = a, *uw2 = b;
 
-	return (RB_FIND(utf8_index_tree, &utf8_index_tree, &ui));
+	if (uw1->wc < uw2->wc)
+		return (-1);
+	if (uw1->wc > uw2->wc)
+		return (1);
+	return (0);
 }
 
 /* Find a codepoint in the cache. */
@@ -288,15 +309,38 @@ utf8_find_in_width_cache(wchar_t wc)
 {
 	struct utf8_width_item	uw;
 
+	if (wc < 0 || wc >= 0x110000 || !utf8_width_cache_blocks[wc >> 8])
+		return (NULL);
 	uw.wc = wc;
-	return RB_FIND(utf8_width_cache, &utf8_width_cache, &uw);
+	return (bsearch(&uw, utf8_width_cache, utf8_width_cache_size,
+	    sizeof *utf8_width_cache, utf8_width_cache_cmp));
+}
+
+/* Add a codepoint to the cache, replacing any existing width. */
+static void
+utf8_add_width(wchar_t wc, u_int width)
+{
+	struct utf8_width_item	*uw;
+	u_int			 i;
+
+	for (i = 0; i < utf8_width_cache_size; i++) {
+		uw = &utf8_width_cache[i];
+		if (uw->wc == wc) {
+			uw->width = width;
+			return;
+		}
+	}
+	utf8_width_cache = xreallocarray(utf8_width_cache,
+	    utf8_width_cache_size + 1, sizeof *utf8_width_cache);
+	uw = &utf8_width_cache[utf8_width_cache_size++];
+	uw->wc = wc;
+	uw->width = width;
 }
 
 /* Parse a single codepoint option. */
 static void
 utf8_add_to_width_cache(const char *s)
 {
-	struct utf8_width_item	*uw, *old;
 	char			*copy, *cp, *endptr;
 	u_int			 width;
 	const char		*errstr;
@@ -351,19 +395,7 @@ utf8_add_to_width_cache(const char *s)
 	}
 
 	log_debug("Unicode width cache: %08X=%u", (u_int)wc, width);
-
-	uw = xcalloc(1, sizeof *uw);
-	uw->wc = wc;
-	uw->width = width;
-	uw->allocated = 1;
-
-	old = RB_INSERT(utf8_width_cache, &utf8_width_cache, uw);
-	if (old != NULL) {
-		RB_REMOVE(utf8_width_cache, &utf8_width_cache, old);
-		if (old->allocated)
-			free(old);
-		RB_INSERT(utf8_width_cache, &utf8_width_cache, uw);
-	}
+	utf8_add_width(wc, width);
 
 	free(copy);
 }
@@ -372,20 +404,17 @@ utf8_add_to_width_cache(const char *s)
 void
 utf8_update_width_cache(void)
 {
-	struct utf8_width_item		*uw, *uw1;
 	struct options_entry		*o;
 	struct options_array_item	*a;
 	u_int				 i;
 
-	RB_FOREACH_SAFE (uw, utf8_width_cache, &utf8_width_cache, uw1) {
-		RB_REMOVE(utf8_width_cache, &utf8_width_cache, uw);
-		if (uw->allocated)
-			free(uw);
-	}
+	free(utf8_width_cache);
+	utf8_width_cache = NULL;
+	utf8_width_cache_size = 0;
 
 	for (i = 0; i < nitems(utf8_default_width_cache); i++) {
-		RB_INSERT(utf8_width_cache, &utf8_width_cache,
-		    &utf8_default_width_cache[i]);
+		utf8_add_width(utf8_default_width_cache[i].wc,
+		    utf8_default_width_cache[i].width);
 	}
 
 	o = options_get(global_options, "codepoint-widths");
@@ -394,6 +423,12 @@ utf8_update_width_cache(void)
 		utf8_add_to_width_cache(options_array_item_value(a)->string);
 		a = options_array_next(a);
 	}
+
+	qsort(utf8_width_cache, utf8_width_cache_size, sizeof *utf8_width_cache,
+	    utf8_width_cache_cmp);
+	memset(utf8_width_cache_blocks, 0, sizeof utf8_width_cache_blocks);
+	for (i = 0; i < utf8_width_cache_size; i++)
+		utf8_width_cache_blocks[utf8_width_cache[i].wc >> 8] = 1;
 }
 
 /* Add a UTF-8 item. */
@@ -401,10 +436,13 @@ static int
 utf8_put_item(const u_char *data, size_t size, u_int *index)
 {
 	struct utf8_item	*ui;
+	u_int			*slot;
 
-	ui = utf8_item_by_data(data, size);
-	if (ui != NULL) {
-		*index = ui->index;
+	if (utf8_hash_size == 0)
+		utf8_grow_hash();
+	slot = utf8_item_by_data(data, size);
+	if (*slot != 0) {
+		*index = *slot - 1;
 		log_debug("%s: found %.*s = %u", __func__, (int)size, data,
 		    *index);
 		return (0);
@@ -413,15 +451,24 @@ utf8_put_item(const u_char *data, size_t size, u_int *index)
 	if (utf8_next_index == 0xffffff + 1)
 		return (-1);
 
-	ui = xcalloc(1, sizeof *ui);
-	ui->index = utf8_next_index++;
-	RB_INSERT(utf8_index_tree, &utf8_index_tree, ui);
-
+	if (utf8_next_index == utf8_list_size) {
+		if (utf8_list_size == 0)
+			utf8_list_size = 64;
+		else
+			utf8_list_size *= 2;
+		utf8_list = xreallocarray(utf8_list, utf8_list_size,
+		    sizeof *utf8_list);
+	}
+	*index = utf8_next_index++;
+	ui = &utf8_list[*index];
 	memcpy(ui->data, data, size);
 	ui->size = size;
-	RB_INSERT(utf8_data_tree, &utf8_data_tree, ui);
+	*slot = *index + 1;
+
+	/* Keep the table at most half full. */
+	if (utf8_next_index > utf8_hash_size / 2)
+		utf8_grow_hash();
 
-	*index = ui->index;
 	log_debug("%s: added %.*s = %u", __func__, (int)size, data, *index);
 	return (0);
 }
@@ -529,21 +576,28 @@ utf8_width(struct utf8_data *ud, int *width)
 		log_debug("cached width for %08X is %d", (u_int)wc, *width);
 		return (UTF8_DONE);
 	}
+	*width = utf8_table_width(wc);
+	if (*width >= 0) {
+		log_debug("width for %05X is %d", (u_int)wc, *width);
+		return (UTF8_DONE);
+	}
+
+	/*
+	 * Not assigned in the version of Unicode the table is from, so ask the
+	 * C library which may know a later version.
+	 */
 #ifdef HAVE_UTF8PROC
 	*width = utf8proc_wcwidth(wc);
-	log_debug("utf8proc_wcwidth(%05X) returned %d", (u_int)wc, *width);
+	log_debug("utf8proc_wcwidth(%05X) returned %d (not in Unicode %s)",
+	    (u_int)wc, *width, utf8_table_version);
 #else
 	*width = wcwidth(wc);
-	log_debug("wcwidth(%05X) returned %d", (u_int)wc, *width);
-	if (*width < 0) {
-		/*
-		 * C1 control characters are nonprintable, so they are always
-		 * zero width.
-		 */
-		*width = (wc >= 0x80 && wc <= 0x9f) ? 0 : 1;
-	}
+	log_debug("wcwidth(%05X) returned %d (not in Unicode %s)", (u_int)wc,
+	    *width, utf8_table_version);
 #endif
-	if (*width >= 0 && *width <= 0xff)
+	if (*width < 0)
+		*width = 1;
+	if (*width <= 0xff)
 		return (UTF8_DONE);
 	return (UTF8_ERROR);
 }
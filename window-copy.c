@@ -58,27 +58,17 @@ static void	window_copy_write_lines(struct window_mode_entry *,
 static char    *window_copy_match_at_cursor(struct window_copy_mode_data *);
 static void	window_copy_scroll_to(struct window_mode_entry *, u_int, u_int,
 		    int);
-static int	window_copy_search_compare(struct grid *, u_int, u_int,
-		    struct grid *, u_int, int);
-static int	window_copy_search_lr(struct grid *, struct grid *, u_int *,
-		    u_int, u_int, u_int, int);
-static int	window_copy_search_rl(struct grid *, struct grid *, u_int *,
-		    u_int, u_int, u_int, int);
-static int	window_copy_last_regex(struct grid *, u_int, u_int, u_int,
-		    u_int, u_int *, u_int *, const char *, const regex_t *,
-		    int);
+static void	window_copy_text_flush(struct window_copy_mode_data *);
+static int	window_copy_search_lr(struct window_copy_mode_data *,
+		    const char *, size_t, u_int *, u_int, u_int, u_int, int);
+static int	window_copy_search_rl(struct window_copy_mode_data *,
+		    const char *, size_t, u_int *, u_int, u_int, u_int, int);
 static int	window_copy_search_mark_at(struct window_copy_mode_data *,
-		    u_int, u_int, u_int *);
-static char    *window_copy_stringify(struct grid *, u_int, u_int, u_int,
-		    char *, u_int *);
-static void	window_copy_cstrtocellpos(struct grid *, u_int, u_int *,
-		    u_int *, const char *);
+		    u_int, u_int, u_int *, u_int *, u_int *);
 static int	window_copy_search_marks(struct window_mode_entry *,
 		    struct screen *, int, int);
 static void	window_copy_clear_marks(struct window_mode_entry *);
 static int	window_copy_is_lowercase(const char *);
-static void	window_copy_search_back_overlap(struct grid *, regex_t *,
-		    u_int *, u_int *, u_int *, u_int);
 static int	window_copy_search_jump(struct window_mode_entry *,
 		    struct grid *, struct grid *, u_int, u_int, u_int, int, int,
 		    int, int);
@@ -148,9 +138,7 @@ static void	window_copy_acquire_cursor_up(struct window_mode_entry *,
 		    u_int, u_int, u_int, u_int, u_int);
 static void	window_copy_acquire_cursor_down(struct window_mode_entry *,
 		    u_int, u_int, u_int, u_int, u_int, u_int, int);
-static u_int	window_copy_clip_width(u_int, u_int, u_int, u_int);
-static u_int	window_copy_search_mark_match(struct window_copy_mode_data *,
-		    u_int , u_int, u_int, int);
+static void	window_copy_search_timer(int, short, void *);
 
 const struct window_mode window_copy_mode = {
 	.name = "copy-mode",
@@ -215,6 +203,82 @@ struct window_copy_cmd_state {
 	struct winlink			*wl;
 };
 
+/*
+ * Text of a line and the lines wrapped after it, used for searching. Each row
+ * has the offset of its first byte and a flag if every cell in the row is one
+ * byte, so an offset can be turned into a cell without looking at the grid.
+ * The last row is cut at the last used cell; trailing is the number of blank
+ * cells after it.
+ *
+ * The text is stored in large chunks which are freed oldest first.
+ */
+struct window_copy_text_row {
+	size_t				 offset;
+	int				 simple;
+};
+struct window_copy_text {
+	u_int				 py;
+	u_int				 ny;
+
+	char				*text;
+	size_t				 len;
+	u_int				 trailing;
+	struct window_copy_text_row	*rows;
+	size_t				 size;
+};
+struct window_copy_text_chunk {
+	char				*data;
+	size_t				 size;
+	size_t				 used;
+
+	TAILQ_ENTRY(window_copy_text_chunk) entry;
+};
+#define WINDOW_COPY_TEXT_CHUNK (256 * 1024)
+
+/*
+ * Search matches, kept in a tree by row with a list of the matches starting in
+ * each row in order. A match may run on into the following rows. Matches do
+ * not overlap.
+ */
+struct window_copy_match {
+	u_int				 px;
+	u_int				 width;
+};
+struct window_copy_match_row {
+	u_int				 py;
+	struct window_copy_match	*list;
+	u_int				 n;
+
+	RB_ENTRY(window_copy_match_row)	 entry;
+};
+RB_HEAD(window_copy_match_rows, window_copy_match_row);
+
+/*
+ * Search marks. Lines are searched a logical line at a time, starting with the
+ * visible lines and then working outwards in short slices from a timer, so
+ * marks for the whole history are built up without blocking.
+ */
+struct window_copy_marks {
+	int				 regex;
+	regex_t				 reg;
+	char				*str;
+	size_t				 len;
+	u_int				 width;
+	int				 cis;
+
+	struct window_copy_match_rows	 rows;
+	struct window_copy_match_row	*last;
+	u_int				 nfound;
+	u_int				 maxwidth;
+
+	bitstr_t			*done;	/* rows already searched */
+	u_int				 lines;
+	u_int				 up;
+	u_int				 down;
+
+	struct event			 timer;
+};
+
 /*
  * Copy mode's visible screen (the "screen" field) is filled from one of two
  * sources: the original contents of the pane (used when we actually enter via
@@ -292,19 +356,22 @@ struct window_copy_mode_data {
 	int		 searchdirection;
 	int		 searchregex;
 	char		*searchstr;
-	u_char		*searchmark;
+	struct window_copy_marks *searchmark;
 	int		 searchcount;
 	int		 searchmore;
 	int		 searchall;
 	int		 searchx;
 	int		 searchy;
 	int		 searcho;
-	u_char		 searchgen;
+#define WINDOW_COPY_SEARCH_SLICE 10
 
-	int		 timeout;	/* search has timed out */
-#define WINDOW_COPY_SEARCH_TIMEOUT 10000
-#define WINDOW_COPY_SEARCH_ALL_TIMEOUT 200
-#define WINDOW_COPY_SEARCH_MAX_LINE 2000
+	struct window_copy_text **texts; /* cached line text by row */
+	u_int		 ntexts;
+	TAILQ_HEAD(window_copy_text_chunks, window_copy_text_chunk) text_chunks;
+	size_t		 texts_size;
+	char		*textbuf;	/* scratch space for line text */
+	size_t		 textbufsize;
+#define WINDOW_COPY_TEXT_MAX (16 * 1024 * 1024)
 
 	int			 jumptype;
 	struct utf8_data	*jumpchar;
@@ -360,17 +427,16 @@ window_copy_clone_screen(struct screen *src, struct screen *hint, u_int *cx,
 	log_debug("%s: target screen is %ux%u, source %ux%u", __func__,
 	    screen_size_x(src), sy, screen_size_x(hint),
 	    screen_hsize(src) + screen_size_y(src));
-	screen_init(dst, screen_size_x(src), sy, screen_hlimit(src));
+	screen_init(dst, screen_size_x(src), sy - screen_hsize(src),
+	    screen_hlimit(src));
 
 	/*
 	 * Ensure history is on for the backing grid so lines are not deleted
 	 * during resizing.
 	 */
 	dst->grid->flags |= GRID_HISTORY;
-	grid_duplicate_lines(dst->grid, 0, src->grid, 0, sy);
+	grid_share_lines(dst->grid, src->grid, sy);
 
-	dst->grid->sy = sy - screen_hsize(src);
-	dst->grid->hsize = screen_hsize(src);
 	dst->grid->hscrolled = src->grid->hscrolled;
 	if (src->cy > dst->grid->sy - 1) {
 		dst->cx = 0;
@@ -421,6 +487,7 @@ window_copy_common_init(struct window_mode_entry *wme)
 	}
 	data->searchx = data->searchy = data->searcho = -1;
 	data->searchall = 1;
+	TAILQ_INIT(&data->text_chunks);
 
 	data->jumptype = WINDOW_COPY_OFF;
 	data->jumpchar = NULL;
@@ -506,9 +573,11 @@ window_copy_free(struct window_mode_entry *wme)
 
 	evtimer_del(&data->dragtimer);
 
-	free(data->searchmark);
+	window_copy_clear_marks(wme);
 	free(data->searchstr);
 	free(data->jumpchar);
+	window_copy_text_flush(data);
+	free(data->textbuf);
 
 	if (data->ictx != NULL)
 		input_free(data->ictx);
@@ -573,8 +642,11 @@ window_copy_vadd(struct window_pane *wp, int parse, const char *fmt, va_list ap)
 		screen_write_vnputs(&backing_ctx, 0, &gc, fmt, ap);
 	}
 	screen_write_stop(&backing_ctx);
+	window_copy_text_flush(data);
 
 	data->oy += screen_hsize(data->backing) - old_hsize;
+	if (data->searchmark != NULL)
+		window_copy_search_marks(wme, NULL, data->searchregex, 0);
 
 	screen_write_start_pane(&ctx, wp, &data->screen);
 
@@ -692,7 +764,7 @@ window_copy_scroll1(struct window_mode_entry *wme, struct window_pane *wp,
 		return;
 	}
 
-	if (data->searchmark != NULL && !data->timeout)
+	if (data->searchmark != NULL)
 		window_copy_search_marks(wme, NULL, data->searchregex, 1);
 	window_copy_update_selection(wme, 1, 0);
 	window_copy_redraw_screen(wme);
@@ -745,7 +817,7 @@ window_copy_pageup1(struct window_mode_entry *wme, int half_page)
 			window_copy_cursor_end_of_line(wme);
 	}
 
-	if (data->searchmark != NULL && !data->timeout)
+	if (data->searchmark != NULL)
 		window_copy_search_marks(wme, NULL, data->searchregex, 1);
 	window_copy_update_selection(wme, 1, 0);
 	window_copy_redraw_screen(wme);
@@ -805,7 +877,7 @@ window_copy_pagedown1(struct window_mode_entry *wme, int half_page,
 
 	if (scroll_exit && data->oy == 0)
 		return (1);
-	if (data->searchmark != NULL && !data->timeout)
+	if (data->searchmark != NULL)
 		window_copy_search_marks(wme, NULL, data->searchregex, 1);
 	window_copy_update_selection(wme, 1, 0);
 	window_copy_redraw_screen(wme);
@@ -969,7 +1041,6 @@ window_copy_formats(struct window_mode_entry *wme, struct format_tree *ft)
 	}
 
 	format_add(ft, "search_present", "%d", data->searchmark != NULL);
-	format_add(ft, "search_timed_out", "%d", data->timeout);
 	if (data->searchcount != -1) {
 		format_add(ft, "search_count", "%d", data->searchcount);
 		format_add(ft, "search_count_partial", "%d", data->searchmore);
@@ -1005,7 +1076,7 @@ window_copy_size_changed(struct window_mode_entry *wme)
 	window_copy_write_lines(wme, &ctx, 0, screen_size_y(s));
 	screen_write_stop(&ctx);
 
-	if (search && !data->timeout)
+	if (search)
 		window_copy_search_marks(wme, NULL, data->searchregex, 0);
 	data->searchx = data->cx;
 	data->searchy = data->cy;
@@ -1030,6 +1101,7 @@ window_copy_resize(struct window_mode_entry *wme, u_int sx, u_int sy)
 	screen_resize_cursor(data->backing, sx, sy, 1, 0, 0);
 	if (reflow)
 		grid_unwrap_position(gd, &cx, &cy, wx, wy);
+	window_copy_text_flush(data);
 
 	data->cx = cx;
 	if (cy < gd->hsize) {
@@ -1619,7 +1691,7 @@ window_copy_cmd_history_bottom(struct window_copy_cmd_state *cs)
 	data->cx = window_copy_find_length(wme, screen_hsize(s) + data->cy);
 	data->oy = 0;
 
-	if (data->searchmark != NULL && !data->timeout)
+	if (data->searchmark != NULL)
 		window_copy_search_marks(wme, NULL, data->searchregex, 1);
 	window_copy_update_selection(wme, 1, 0);
 	return (WINDOW_COPY_CMD_REDRAW);
@@ -1640,7 +1712,7 @@ window_copy_cmd_history_top(struct window_copy_cmd_state *cs)
 	data->cx = 0;
 	data->oy = screen_hsize(data->backing);
 
-	if (data->searchmark != NULL && !data->timeout)
+	if (data->searchmark != NULL)
 		window_copy_search_marks(wme, NULL, data->searchregex, 1);
 	window_copy_update_selection(wme, 1, 0);
 	return (WINDOW_COPY_CMD_REDRAW);
@@ -2517,7 +2589,6 @@ window_copy_cmd_search_backward(struct window_copy_cmd_state *cs)
 	if (data->searchstr != NULL) {
 		data->searchtype = WINDOW_COPY_SEARCHUP;
 		data->searchregex = 1;
-		data->timeout = 0;
 		for (; np != 0; np--)
 			window_copy_search_up(wme, 1);
 	}
@@ -2537,7 +2608,6 @@ window_copy_cmd_search_backward_text(struct window_copy_cmd_state *cs)
 	if (data->searchstr != NULL) {
 		data->searchtype = WINDOW_COPY_SEARCHUP;
 		data->searchregex = 0;
-		data->timeout = 0;
 		for (; np != 0; np--)
 			window_copy_search_up(wme, 0);
 	}
@@ -2557,7 +2627,6 @@ window_copy_cmd_search_forward(struct window_copy_cmd_state *cs)
 	if (data->searchstr != NULL) {
 		data->searchtype = WINDOW_COPY_SEARCHDOWN;
 		data->searchregex = 1;
-		data->timeout = 0;
 		for (; np != 0; np--)
 			window_copy_search_down(wme, 1);
 	}
@@ -2577,7 +2646,6 @@ window_copy_cmd_search_forward_text(struct window_copy_cmd_state *cs)
 	if (data->searchstr != NULL) {
 		data->searchtype = WINDOW_COPY_SEARCHDOWN;
 		data->searchregex = 0;
-		data->timeout = 0;
 		for (; np != 0; np--)
 			window_copy_search_down(wme, 0);
 	}
@@ -2594,8 +2662,6 @@ window_copy_cmd_search_backward_incremental(struct window_copy_cmd_state *cs)
 	char				 prefix;
 	enum window_copy_cmd_action	 action = WINDOW_COPY_CMD_NOTHING;
 
-	data->timeout = 0;
-
 	log_debug("%s: %s", __func__, arg0);
 
 	prefix = *arg0++;
@@ -2649,8 +2715,6 @@ window_copy_cmd_search_forward_incremental(struct window_copy_cmd_state *cs)
 	char				 prefix;
 	enum window_copy_cmd_action	 action = WINDOW_COPY_CMD_NOTHING;
 
-	data->timeout = 0;
-
 	log_debug("%s: %s", __func__, arg0);
 
 	prefix = *arg0++;
@@ -2707,6 +2771,7 @@ window_copy_cmd_refresh_from_pane(struct window_copy_cmd_state *cs)
 	free(data->backing);
 	data->backing = window_copy_clone_screen(&wp->base, &data->screen, NULL,
 	    NULL, wme->swp != wme->wp);
+	window_copy_text_flush(data);
 
 	if (data->oy > screen_hsize(data->backing)) {
 		data->cy = 0;
@@ -3280,458 +3345,554 @@ window_copy_scroll_to(struct window_mode_entry *wme, u_int px, u_int py,
 		data->oy = gd->hsize - offset;
 	}
 
-	if (!no_redraw && data->searchmark != NULL && !data->timeout)
+	if (!no_redraw && data->searchmark != NULL)
 		window_copy_search_marks(wme, NULL, data->searchregex, 1);
 	window_copy_update_selection(wme, 1, 0);
 	if (!no_redraw)
 		window_copy_redraw_screen(wme);
 }
 
-static int
-window_copy_search_compare(struct grid *gd, u_int px, u_int py,
-    struct grid *sgd, u_int spx, int cis)
+/* Free a chunk of cached lines. */
+static void
+window_copy_text_free(struct window_copy_mode_data *data,
+    struct window_copy_text_chunk *tc)
 {
-	struct grid_cell	 gc, sgc;
-	const struct utf8_data	*ud, *sud;
-
-	grid_get_cell(gd, px, py, &gc);
-	ud = &gc.data;
-	grid_get_cell(sgd, spx, 0, &sgc);
-	sud = &sgc.data;
-
-	if (*sud->data == '\t' && sud->size == 1 && gc.flags & GRID_FLAG_TAB)
-		return (1);
+	struct window_copy_text	*t;
+	size_t			 off;
+	u_int			 y;
 
-	if (ud->size != sud->size || ud->width != sud->width)
-		return (0);
-
-	if (cis && ud->size == 1)
-		return (tolower(ud->data[0]) == sud->data[0]);
+	for (off = 0; off < tc->used; off += t->size) {
+		t = (struct window_copy_text *)(tc->data + off);
+		for (y = t->py; y < t->py + t->ny; y++)
+			data->texts[y] = NULL;
+	}
+	TAILQ_REMOVE(&data->text_chunks, tc, entry);
+	data->texts_size -= tc->size;
 
-	return (memcmp(ud->data, sud->data, ud->size) == 0);
+	free(tc->data);
+	free(tc);
 }
 
-static int
-window_copy_search_lr(struct grid *gd, struct grid *sgd, u_int *ppx, u_int py,
-    u_int first, u_int last, int cis)
+/* Free all cached lines, needed whenever the backing screen changes. */
+static void
+window_copy_text_flush(struct window_copy_mode_data *data)
 {
-	u_int			 ax, bx, px, pywrap, endline, padding;
-	int			 matched;
-	struct grid_line	*gl;
-	struct grid_cell	 gc;
-
-	endline = gd->hsize + gd->sy - 1;
-	for (ax = first; ax < last; ax++) {
-		padding = 0;
-		for (bx = 0; bx < sgd->sx; bx++) {
-			px = ax + bx + padding;
-			pywrap = py;
-			/* Wrap line. */
-			while (px >= gd->sx && pywrap < endline) {
-				gl = grid_get_line(gd, pywrap);
-				if (~gl->flags & GRID_LINE_WRAPPED)
-					break;
-				px -= gd->sx;
-				pywrap++;
-			}
-			/* We have run off the end of the grid. */
-			if (px - padding >= gd->sx)
-				break;
+	struct window_copy_text_chunk	*tc, *tc1;
 
-			grid_get_cell(gd, px, pywrap, &gc);
-			if (gc.flags & GRID_FLAG_TAB)
-				padding += gc.data.width - 1;
+	TAILQ_FOREACH_SAFE(tc, &data->text_chunks, entry, tc1)
+		window_copy_text_free(data, tc);
+	free(data->texts);
+	data->texts = NULL;
+	data->ntexts = 0;
+}
 
-			matched = window_copy_search_compare(gd, px, pywrap,
-			    sgd, bx, cis);
-			if (!matched)
-				break;
-		}
-		if (bx == sgd->sx) {
-			*ppx = ax;
-			return (1);
+/*
+ * Get space for a cached line, freeing the oldest chunks if the cache is too
+ * big.
+ */
+static void *
+window_copy_text_space(struct window_copy_mode_data *data, size_t size)
+{
+	struct window_copy_text_chunk	*tc;
+	void				*space;
+
+	size = (size + 7) & ~(size_t)7;
+
+	tc = TAILQ_LAST(&data->text_chunks, window_copy_text_chunks);
+	if (tc == NULL || tc->used + size > tc->size) {
+		tc = xcalloc(1, sizeof *tc);
+		tc->size = WINDOW_COPY_TEXT_CHUNK;
+		if (size > tc->size)
+			tc->size = size;
+		tc->data = xmalloc(tc->size);
+		TAILQ_INSERT_TAIL(&data->text_chunks, tc, entry);
+		data->texts_size += tc->size;
+
+		while (data->texts_size > WINDOW_COPY_TEXT_MAX &&
+		    TAILQ_FIRST(&data->text_chunks) != tc) {
+			window_copy_text_free(data,
+			    TAILQ_FIRST(&data->text_chunks));
 		}
 	}
-	return (0);
+
+	space = tc->data + tc->used;
+	tc->used += size;
+	return (space);
 }
 
-static int
-window_copy_search_rl(struct grid *gd,
-    struct grid *sgd, u_int *ppx, u_int py, u_int first, u_int last, int cis)
+/* Make sure there is enough scratch space. */
+static void
+window_copy_text_buffer(struct window_copy_mode_data *data, size_t size)
 {
-	u_int			 ax, bx, px, pywrap, endline, padding;
-	int			 matched;
-	struct grid_line	*gl;
-	struct grid_cell	 gc;
-
-	endline = gd->hsize + gd->sy - 1;
-	for (ax = last; ax > first; ax--) {
-		padding = 0;
-		for (bx = 0; bx < sgd->sx; bx++) {
-			px = ax - 1 + bx + padding;
-			pywrap = py;
-			/* Wrap line. */
-			while (px >= gd->sx && pywrap < endline) {
-				gl = grid_get_line(gd, pywrap);
-				if (~gl->flags & GRID_LINE_WRAPPED)
-					break;
-				px -= gd->sx;
-				pywrap++;
-			}
-			/* We have run off the end of the grid. */
-			if (px - padding >= gd->sx)
-				break;
-
-			grid_get_cell(gd, px, pywrap, &gc);
-			if (gc.flags & GRID_FLAG_TAB)
-				padding += gc.data.width - 1;
-
-			matched = window_copy_search_compare(gd, px, pywrap,
-			    sgd, bx, cis);
-			if (!matched)
-				break;
-		}
-		if (bx == sgd->sx) {
-			*ppx = ax - 1;
-			return (1);
-		}
+	if (size > data->textbufsize) {
+		data->textbufsize = size;
+		data->textbuf = xrealloc(data->textbuf, data->textbufsize);
 	}
-	return (0);
 }
 
-static int
-window_copy_search_lr_regex(struct grid *gd, u_int *ppx, u_int *psx, u_int py,
-    u_int first, u_int last, regex_t *reg)
+/* Get the bytes for a cell. Padding cells have none. */
+static size_t
+window_copy_text_cell(const struct grid_line *gl, u_int px,
+    struct utf8_data *ud, const char **d)
 {
-	int			eflags = 0;
-	u_int			endline, foundx, foundy, len, pywrap, size = 1;
-	char		       *buf;
-	regmatch_t		regmatch;
-	struct grid_line       *gl;
+	struct grid_cell_entry	*gce;
+	int			 flags;
 
-	/*
-	 * This can happen during search if the last match was the last
-	 * character on a line.
-	 */
-	if (first >= last)
+	if (px >= gl->cellsize) {
+		*d = " ";
+		return (1);
+	}
+	gce = &gl->celldata[px];
+	if (~gce->flags & GRID_FLAG_EXTENDED) {
+		*d = &gce->data.data;
+		return (1);
+	}
+
+	/* The flags of an extended cell are kept with its style. */
+	flags = grid_cell_flags(gl, px);
+	if (flags & GRID_FLAG_PADDING)
 		return (0);
+	if (flags & GRID_FLAG_TAB) {
+		*d = "\t";
+		return (1);
+	}
+	if (gce->offset >= gl->extdsize) {
+		*d = " ";
+		return (1);
+	}
+	utf8_to_data(gl->extddata[gce->offset].data, ud);
+	*d = ud->data;
+	return (ud->size);
+}
 
-	/* Set flags for regex search. */
-	if (first != 0)
-		eflags |= REG_NOTBOL;
+/* Get the text of the line containing row py, building it if needed. */
+static struct window_copy_text *
+window_copy_text_get(struct window_copy_mode_data *data, u_int py)
+{
+	struct grid			*gd = data->backing->grid;
+	struct window_copy_text		*t;
+	struct window_copy_text_row	*rows;
+	const struct grid_line		*gl;
+	struct utf8_data		 ud;
+	const char			*d;
+	u_int				 start, end, endline, ny, y, x, last;
+	size_t				 n, len = 0, size;
 
-	/* Need to look at the entire string. */
-	buf = xmalloc(size);
-	buf[0] = '\0';
-	buf = window_copy_stringify(gd, py, first, gd->sx, buf, &size);
-	len = gd->sx - first;
 	endline = gd->hsize + gd->sy - 1;
-	pywrap = py;
-	while (buf != NULL &&
-	    pywrap <= endline &&
-	    len < WINDOW_COPY_SEARCH_MAX_LINE) {
-		gl = grid_get_line(gd, pywrap);
-		if (~gl->flags & GRID_LINE_WRAPPED)
+	if (data->texts == NULL) {
+		data->ntexts = endline + 1;
+		data->texts = xcalloc(data->ntexts, sizeof *data->texts);
+	}
+	if (data->texts[py] != NULL)
+		return (data->texts[py]);
+
+	for (start = py; start > 0; start--) {
+		if (~grid_peek_line(gd, start - 1)->flags & GRID_LINE_WRAPPED)
+			break;
+	}
+	for (end = py; end < endline; end++) {
+		if (~grid_peek_line(gd, end)->flags & GRID_LINE_WRAPPED)
 			break;
-		pywrap++;
-		buf = window_copy_stringify(gd, pywrap, 0, gd->sx, buf, &size);
-		len += gd->sx;
-	}
-
-	if (regexec(reg, buf, 1, &regmatch, eflags) == 0 &&
-	    regmatch.rm_so != regmatch.rm_eo) {
-		foundx = first;
-		foundy = py;
-		window_copy_cstrtocellpos(gd, len, &foundx, &foundy,
-		    buf + regmatch.rm_so);
-		if (foundy == py && foundx < last) {
-			*ppx = foundx;
-			len -= foundx - first;
-			window_copy_cstrtocellpos(gd, len, &foundx, &foundy,
-			    buf + regmatch.rm_eo);
-			*psx = foundx;
-			while (foundy > py) {
-				*psx += gd->sx;
-				foundy--;
+	}
+	ny = end - start + 1;
+
+	/* Build the text in the scratch space, rows at the start. */
+	len = (ny + 1) * sizeof *rows;
+	for (y = 0; y < ny; y++) {
+		gl = grid_peek_line(gd, start + y);
+		if (y == ny - 1 && gl->cellused < gd->sx)
+			last = gl->cellused;
+		else
+			last = gd->sx;
+		window_copy_text_buffer(data, len + last * UTF8_SIZE);
+		rows = (struct window_copy_text_row *)data->textbuf;
+
+		rows[y].offset = len;
+		rows[y].simple = 1;
+		for (x = 0; x < last; x++) {
+			n = window_copy_text_cell(gl, x, &ud, &d);
+			if (n == 1)
+				data->textbuf[len++] = *d;
+			else {
+				rows[y].simple = 0;
+				memcpy(data->textbuf + len, d, n);
+				len += n;
 			}
-			*psx -= *ppx;
-			free(buf);
-			return (1);
 		}
 	}
+	rows = (struct window_copy_text_row *)data->textbuf;
+	for (y = 0; y < ny; y++)
+		rows[y].offset -= (ny + 1) * sizeof *rows;
+	rows[ny].offset = len - (ny + 1) * sizeof *rows;
+
+	size = sizeof *t + len + 1;
+	t = window_copy_text_space(data, size);
+	t->py = start;
+	t->ny = ny;
+	t->rows = (struct window_copy_text_row *)(t + 1);
+	t->text = (char *)(t->rows + ny + 1);
+	t->len = rows[ny].offset;
+	t->trailing = gd->sx - last;
+	t->size = (size + 7) & ~(size_t)7;
+	memcpy(t->rows, data->textbuf, len);
+	t->text[t->len] = '\0';
+
+	for (y = start; y <= end; y++)
+		data->texts[y] = t;
+	return (t);
+}
+
+/* Get the number of cells in a row of the text. */
+static u_int
+window_copy_text_cells(struct window_copy_mode_data *data,
+    struct window_copy_text *t, u_int r)
+{
+	u_int	sx = screen_size_x(data->backing);
 
-	free(buf);
-	*ppx = 0;
-	*psx = 0;
-	return (0);
+	if (r == t->ny - 1)
+		return (sx - t->trailing);
+	return (sx);
 }
 
-static int
-window_copy_search_rl_regex(struct grid *gd, u_int *ppx, u_int *psx, u_int py,
-    u_int first, u_int last, regex_t *reg)
-{
-	int			eflags = 0;
-	u_int			endline, len, pywrap, size = 1;
-	char		       *buf;
-	struct grid_line       *gl;
-
-	/* Set flags for regex search. */
-	if (first != 0)
-		eflags |= REG_NOTBOL;
-
-	/* Need to look at the entire string. */
-	buf = xmalloc(size);
-	buf[0] = '\0';
-	buf = window_copy_stringify(gd, py, first, gd->sx, buf, &size);
-	len = gd->sx - first;
-	endline = gd->hsize + gd->sy - 1;
-	pywrap = py;
-	while (buf != NULL &&
-	    pywrap <= endline &&
-	    len < WINDOW_COPY_SEARCH_MAX_LINE) {
-		gl = grid_get_line(gd, pywrap);
-		if (~gl->flags & GRID_LINE_WRAPPED)
-			break;
-		pywrap++;
-		buf = window_copy_stringify(gd, pywrap, 0, gd->sx, buf, &size);
-		len += gd->sx;
-	}
+/*
+ * Get the offset of a cell in a row of the text. Cells after the end of the
+ * text are counted as one byte each.
+ */
+static size_t
+window_copy_text_offset(struct window_copy_mode_data *data,
+    struct window_copy_text *t, u_int r, u_int px)
+{
+	struct grid		*gd = data->backing->grid;
+	const struct grid_line	*gl;
+	struct utf8_data	 ud;
+	const char		*d;
+	u_int			 x, cells = window_copy_text_cells(data, t, r);
+	size_t			 offset = t->rows[r].offset;
 
-	if (window_copy_last_regex(gd, py, first, last, len, ppx, psx, buf,
-	    reg, eflags))
-	{
-		free(buf);
-		return (1);
+	if (px >= cells) {
+		if (r == t->ny - 1)
+			return (t->len + (px - cells));
+		return (t->rows[r + 1].offset);
 	}
-
-	free(buf);
-	*ppx = 0;
-	*psx = 0;
-	return (0);
+	if (t->rows[r].simple)
+		return (offset + px);
+	gl = grid_peek_line(gd, t->py + r);
+	for (x = 0; x < px; x++)
+		offset += window_copy_text_cell(gl, x, &ud, &d);
+	return (offset);
 }
 
-static const char *
-window_copy_cellstring(const struct grid_line *gl, u_int px, size_t *size,
-    int *allocated)
+/*
+ * Get the cell starting at an offset in the text. Returns 0 if the offset is
+ * in the middle of a cell.
+ */
+static int
+window_copy_text_position(struct window_copy_mode_data *data,
+    struct window_copy_text *t, size_t offset, u_int *ppx, u_int *ppy)
 {
-	static struct utf8_data	 ud;
-	struct grid_cell_entry	*gce;
-	char			*copy;
+	struct grid		*gd = data->backing->grid;
+	const struct grid_line	*gl;
+	struct utf8_data	 ud;
+	const char		*d;
+	u_int			 lo, hi, r, x, cells;
+	size_t			 at, n;
 
-	if (px >= gl->cellsize) {
-		*size = 1;
-		*allocated = 0;
-		return (" ");
+	if (offset >= t->len) {
+		r = t->ny - 1;
+		*ppx = window_copy_text_cells(data, t, r) + (offset - t->len);
+		*ppy = t->py + r;
+		return (1);
 	}
 
-	gce = &gl->celldata[px];
-	if (gce->flags & GRID_FLAG_PADDING) {
-		*size = 0;
-		*allocated = 0;
-		return (NULL);
+	lo = 0;
+	hi = t->ny - 1;
+	while (lo < hi) {
+		r = (lo + hi + 1) / 2;
+		if (t->rows[r].offset <= offset)
+			lo = r;
+		else
+			hi = r - 1;
 	}
-	if (~gce->flags & GRID_FLAG_EXTENDED) {
-		*size = 1;
-		*allocated = 0;
-		return (&gce->data.data);
+	r = lo;
+	*ppy = t->py + r;
+
+	at = t->rows[r].offset;
+	if (t->rows[r].simple) {
+		*ppx = offset - at;
+		return (1);
 	}
-	if (gce->flags & GRID_FLAG_TAB) {
-		*size = 1;
-		*allocated = 0;
-		return ("\t");
+	gl = grid_peek_line(gd, t->py + r);
+	cells = window_copy_text_cells(data, t, r);
+	for (x = 0; x < cells; x++) {
+		n = window_copy_text_cell(gl, x, &ud, &d);
+		if (n == 0)
+			continue;
+		if (at == offset) {
+			*ppx = x;
+			return (1);
+		}
+		at += n;
+		if (at > offset)
+			break;
 	}
+	return (0);
+}
 
-	utf8_to_data(gl->extddata[gce->offset].data, &ud);
-	if (ud.size == 0) {
-		*size = 0;
-		*allocated = 0;
-		return (NULL);
-	}
-	*size = ud.size;
-	*allocated = 1;
+/* Is there a match at an offset? It must start and end on a cell. */
+static int
+window_copy_text_match(struct window_copy_mode_data *data,
+    struct window_copy_text *t, size_t offset, size_t len)
+{
+	u_int	px, py;
 
-	copy = xmalloc(ud.size);
-	memcpy(copy, ud.data, ud.size);
-	return (copy);
+	if (!window_copy_text_position(data, t, offset, &px, &py))
+		return (0);
+	return (window_copy_text_position(data, t, offset + len, &px, &py));
 }
 
-/* Find last match in given range. */
+/*
+ * Is there a match at an offset which runs past the end of the text into the
+ * blank cells after it? The search text must end in enough spaces.
+ */
 static int
-window_copy_last_regex(struct grid *gd, u_int py, u_int first, u_int last,
-    u_int len, u_int *ppx, u_int *psx, const char *buf, const regex_t *preg,
-    int eflags)
+window_copy_text_match_blank(struct window_copy_mode_data *data,
+    struct window_copy_text *t, const char *str, size_t len, size_t spaces,
+    size_t offset, int cis)
 {
-	u_int		foundx, foundy, oldx, px = 0, savepx, savesx = 0;
-	regmatch_t	regmatch;
+	size_t	n, i;
+	u_int	px, py;
 
-	foundx = first;
-	foundy = py;
-	oldx = first;
-	while (regexec(preg, buf + px, 1, &regmatch, eflags) == 0) {
-		if (regmatch.rm_so == regmatch.rm_eo)
-			break;
-		window_copy_cstrtocellpos(gd, len, &foundx, &foundy,
-		    buf + px + regmatch.rm_so);
-		if (foundy > py || foundx >= last)
-			break;
-		len -= foundx - oldx;
-		savepx = foundx;
-		window_copy_cstrtocellpos(gd, len, &foundx, &foundy,
-		    buf + px + regmatch.rm_eo);
-		if (foundy > py || foundx >= last) {
-			*ppx = savepx;
-			*psx = foundx;
-			while (foundy > py) {
-				*psx += gd->sx;
-				foundy--;
+	if (offset >= t->len)
+		return (spaces == len);
+	n = t->len - offset;
+	if (len - n > spaces)
+		return (0);
+	for (i = 0; i < n; i++) {
+		if (cis && tolower((u_char)t->text[offset + i]) != (u_char)str[i])
+			return (0);
+		if (!cis && t->text[offset + i] != str[i])
+			return (0);
+	}
+	return (window_copy_text_position(data, t, offset, &px, &py));
+}
+
+/*
+ * Search for text starting between first and last in row py, in either
+ * direction. The text may continue onto following wrapped rows and past the
+ * end of the line into blank cells. If cis then ignore case in the line (the
+ * search text is already lowercase).
+ */
+static int
+window_copy_search_text(struct window_copy_mode_data *data, const char *str,
+    size_t len, u_int *ppx, u_int py, u_int first, u_int last, int cis,
+    int reverse)
+{
+	struct window_copy_text	*t;
+	const char		*hay, *at;
+	size_t			 from, to, end, offset = 0, i, j, spaces;
+	size_t			 lo, hi;
+	u_int			 r, px, y;
+	int			 found = 0;
+
+	if (len == 0 || first >= last)
+		return (0);
+	t = window_copy_text_get(data, py);
+	r = py - t->py;
+	from = window_copy_text_offset(data, t, r, first);
+	to = window_copy_text_offset(data, t, r, last);
+	if (from >= to)
+		return (0);
+
+	/* Matches entirely within the text may start from..to. */
+	end = to - 1 + len;
+	if (end > t->len)
+		end = t->len;
+	if (from < end) {
+		hay = t->text + from;
+		if (cis) {
+			window_copy_text_buffer(data, end - from);
+			for (i = 0; i < end - from; i++) {
+				if ((u_char)hay[i] < 0x80)
+					data->textbuf[i] = tolower((u_char)hay[i]);
+				else
+					data->textbuf[i] = hay[i];
 			}
-			*psx -= *ppx;
-			return (1);
-		} else {
-			savesx = foundx - savepx;
-			len -= savesx;
-			oldx = foundx;
+			hay = data->textbuf;
+		}
+		at = hay;
+		while ((at = memmem(at, hay + (end - from) - at, str,
+		    len)) != NULL) {
+			if (window_copy_text_match(data, t, from + (at - hay),
+			    len)) {
+				offset = from + (at - hay);
+				found = 1;
+				if (!reverse)
+					break;
+			}
+			at++;
 		}
-		px += regmatch.rm_eo;
 	}
 
-	if (savesx > 0) {
-		*ppx = savepx;
-		*psx = savesx;
-		return (1);
-	} else {
-		*ppx = 0;
-		*psx = 0;
-		return (0);
+	/*
+	 * Matches running into the blank cells after the text start after any
+	 * match within it, at most at the last blank cell.
+	 */
+	if ((!found || reverse) && t->len + t->trailing >= len) {
+		for (spaces = 0; spaces < len; spaces++) {
+			if (str[len - 1 - spaces] != ' ')
+				break;
+		}
+		lo = from;
+		if (lo + len <= t->len)
+			lo = t->len - len + 1;
+		hi = t->len + t->trailing - len;
+		if (hi > to - 1)
+			hi = to - 1;
+		if (spaces != len && hi >= t->len)
+			hi = t->len - 1;
+		for (i = 0; lo + i <= hi && hi != (size_t)-1; i++) {
+			j = reverse ? hi - i : lo + i;
+			if (window_copy_text_match_blank(data, t, str, len,
+			    spaces, j, cis)) {
+				offset = j;
+				found = 1;
+				break;
+			}
+		}
 	}
+	if (!found)
+		return (0);
+
+	window_copy_text_position(data, t, offset, &px, &y);
+	*ppx = px;
+	return (1);
 }
 
-/* Stringify line and append to input buffer. Caller frees. */
+/* Get the text to search for from the screen holding the search string. */
 static char *
-window_copy_stringify(struct grid *gd, u_int py, u_int first, u_int last,
-    char *buf, u_int *size)
+window_copy_search_needle(struct grid *sgd, size_t *len)
 {
-	u_int			 ax, bx, newsize = *size;
-	const struct grid_line	*gl;
+	const struct grid_line	*gl = grid_peek_line(sgd, 0);
+	struct utf8_data	 ud;
 	const char		*d;
-	size_t			 bufsize = 1024, dlen;
-	int			 allocated;
-
-	while (bufsize < newsize)
-		bufsize *= 2;
-	buf = xrealloc(buf, bufsize);
-
-	gl = grid_peek_line(gd, py);
-	bx = *size - 1;
-	for (ax = first; ax < last; ax++) {
-		d = window_copy_cellstring(gl, ax, &dlen, &allocated);
-		newsize += dlen;
-		while (bufsize < newsize) {
-			bufsize *= 2;
-			buf = xrealloc(buf, bufsize);
-		}
-		if (dlen == 1)
-			buf[bx++] = *d;
-		else {
-			memcpy(buf + bx, d, dlen);
-			bx += dlen;
-		}
-		if (allocated)
-			free((void *)d);
+	char			*buf = NULL;
+	u_int			 x;
+	size_t			 n;
+
+	*len = 0;
+	for (x = 0; x < sgd->sx; x++) {
+		n = window_copy_text_cell(gl, x, &ud, &d);
+		buf = xrealloc(buf, *len + n + 1);
+		memcpy(buf + *len, d, n);
+		*len += n;
+		buf[*len] = '\0';
 	}
-	buf[newsize - 1] = '\0';
-
-	*size = newsize;
+	if (buf == NULL)
+		buf = xcalloc(1, 1);
 	return (buf);
 }
 
-/* Map start of C string containing UTF-8 data to grid cell position. */
+static int
+window_copy_search_lr(struct window_copy_mode_data *data, const char *str,
+    size_t len, u_int *ppx, u_int py, u_int first, u_int last, int cis)
+{
+	return (window_copy_search_text(data, str, len, ppx, py, first, last,
+	    cis, 0));
+}
+
+static int
+window_copy_search_rl(struct window_copy_mode_data *data, const char *str,
+    size_t len, u_int *ppx, u_int py, u_int first, u_int last, int cis)
+{
+	return (window_copy_search_text(data, str, len, ppx, py, first, last,
+	    cis, 1));
+}
+
+/*
+ * Get the cell at the end of a regex match, moving on if the end is in the
+ * middle of a cell.
+ */
 static void
-window_copy_cstrtocellpos(struct grid *gd, u_int ncells, u_int *ppx, u_int *ppy,
-    const char *str)
+window_copy_search_regex_end(struct window_copy_mode_data *data,
+    struct window_copy_text *t, size_t end, u_int *ppx, u_int *ppy)
 {
-	u_int			 cell, ccell, px, pywrap, pos, len;
-	int			 match;
-	const struct grid_line	*gl;
-	const char		*d;
-	size_t			 dlen;
-	struct {
-		const char	*d;
-		size_t		 dlen;
-		int		 allocated;
-	} *cells;
-
-	/* Populate the array of cell data. */
-	cells = xreallocarray(NULL, ncells, sizeof cells[0]);
-	cell = 0;
-	px = *ppx;
-	pywrap = *ppy;
-	gl = grid_peek_line(gd, pywrap);
-	while (cell < ncells) {
-		cells[cell].d = window_copy_cellstring(gl, px,
-		    &cells[cell].dlen, &cells[cell].allocated);
-		cell++;
-		px++;
-		if (px == gd->sx) {
-			px = 0;
-			pywrap++;
-			gl = grid_peek_line(gd, pywrap);
-		}
-	}
+	while (!window_copy_text_position(data, t, end, ppx, ppy))
+		end++;
+}
 
-	/* Locate starting cell. */
-	cell = 0;
-	len = strlen(str);
-	while (cell < ncells) {
-		ccell = cell;
-		pos = 0;
-		match = 1;
-		while (ccell < ncells) {
-			if (str[pos] == '\0') {
-				match = 0;
-				break;
-			}
-			d = cells[ccell].d;
-			dlen = cells[ccell].dlen;
-			if (dlen == 1) {
-				if (str[pos] != *d) {
-					match = 0;
-					break;
-				}
-				pos++;
-			} else {
-				if (dlen > len - pos)
-					dlen = len - pos;
-				if (memcmp(str + pos, d, dlen) != 0) {
-					match = 0;
-					break;
-				}
-				pos += dlen;
-			}
-			ccell++;
-		}
-		if (match)
+/*
+ * Find the first regex match starting at or after a cell in the logical line
+ * containing it. Matches may start in any row of the line.
+ */
+static int
+window_copy_search_lr_regex(struct window_copy_mode_data *data, u_int *ppx,
+    u_int *ppy, u_int *psx, u_int px, u_int py, regex_t *reg)
+{
+	struct window_copy_text	*t;
+	u_int			 sx = screen_size_x(data->backing), ex, ey;
+	size_t			 from, start;
+	regmatch_t		 regmatch;
+	int			 eflags;
+
+	t = window_copy_text_get(data, py);
+	from = window_copy_text_offset(data, t, py - t->py, px);
+	while (from < t->len) {
+		eflags = (from == 0) ? 0 : REG_NOTBOL;
+		if (regexec(reg, t->text + from, 1, &regmatch, eflags) != 0)
 			break;
-		cell++;
-	}
-
-	/* If not found this will be one past the end. */
-	px = *ppx + cell;
-	pywrap = *ppy;
-	while (px >= gd->sx) {
-		px -= gd->sx;
-		pywrap++;
+		if (regmatch.rm_so == regmatch.rm_eo)
+			break;
+		start = from + regmatch.rm_so;
+		if (!window_copy_text_position(data, t, start, ppx, ppy)) {
+			from = start + 1;
+			continue;
+		}
+		window_copy_search_regex_end(data, t, from + regmatch.rm_eo,
+		    &ex, &ey);
+		*psx = (ey - *ppy) * sx + ex - *ppx;
+		return (1);
 	}
+	return (0);
+}
 
-	*ppx = px;
-	*ppy = pywrap;
-
-	/* Free cell data. */
-	for (cell = 0; cell < ncells; cell++) {
-		if (cells[cell].allocated)
-			free((void *)cells[cell].d);
+/*
+ * Find the last regex match starting before a cell in the logical line
+ * containing it. Matches are found from the start of the line so they are the
+ * same as searching forward.
+ */
+static int
+window_copy_search_rl_regex(struct window_copy_mode_data *data, u_int *ppx,
+    u_int *ppy, u_int *psx, u_int px, u_int py, regex_t *reg)
+{
+	struct window_copy_text	*t;
+	u_int			 sx = screen_size_x(data->backing), ex, ey;
+	u_int			 mx, my;
+	size_t			 from = 0, start, end, limit;
+	regmatch_t		 regmatch;
+	int			 eflags, found = 0;
+
+	t = window_copy_text_get(data, py);
+	limit = window_copy_text_offset(data, t, py - t->py, px);
+	while (from < t->len) {
+		eflags = (from == 0) ? 0 : REG_NOTBOL;
+		if (regexec(reg, t->text + from, 1, &regmatch, eflags) != 0)
+			break;
+		if (regmatch.rm_so == regmatch.rm_eo)
+			break;
+		start = from + regmatch.rm_so;
+		if (start >= limit)
+			break;
+		end = from + regmatch.rm_eo;
+		if (window_copy_text_position(data, t, start, &mx, &my)) {
+			window_copy_search_regex_end(data, t, end, &ex, &ey);
+			*ppx = mx;
+			*ppy = my;
+			*psx = (ey - my) * sx + ex - mx;
+			found = 1;
+		}
+		from = end;
 	}
-	free(cells);
+	return (found);
 }
 
 static void
@@ -3779,48 +3940,6 @@ window_copy_is_lowercase(const char *ptr)
 	return (1);
 }
 
-/*
- * Handle backward wrapped regex searches with overlapping matches. In this case
- * find the longest overlapping match from previous wrapped lines.
- */
-static void
-window_copy_search_back_overlap(struct grid *gd, regex_t *preg, u_int *ppx,
-    u_int *psx, u_int *ppy, u_int endline)
-{
-	u_int	endx, endy, oldendx, oldendy, px, py, sx;
-	int	found = 1;
-
-	oldendx = *ppx + *psx;
-	oldendy = *ppy - 1;
-	while (oldendx > gd->sx - 1) {
-		oldendx -= gd->sx;
-		oldendy++;
-	}
-	endx = oldendx;
-	endy = oldendy;
-	px = *ppx;
-	py = *ppy;
-	while (found && px == 0 && py - 1 > endline &&
-	       grid_get_line(gd, py - 2)->flags & GRID_LINE_WRAPPED &&
-	       endx == oldendx && endy == oldendy) {
-		py--;
-		found = window_copy_search_rl_regex(gd, &px, &sx, py - 1, 0,
-		    gd->sx, preg);
-		if (found) {
-			endx = px + sx;
-			endy = py - 1;
-			while (endx > gd->sx - 1) {
-				endx -= gd->sx;
-				endy++;
-			}
-			if (endx == oldendx && endy == oldendy) {
-				*ppx = px;
-				*ppy = py;
-			}
-		}
-	}
-}
-
 /*
  * Search for text stored in sgd starting from position fx,fy up to endline. If
  * found, jump to it. If cis then ignore case. The direction is 0 for searching
@@ -3832,50 +3951,62 @@ window_copy_search_jump(struct window_mode_entry *wme, struct grid *gd,
     struct grid *sgd, u_int fx, u_int fy, u_int endline, int cis, int wrap,
     int direction, int regex)
 {
-	u_int	 i, px, sx, ssize = 1;
-	int	 found = 0, cflags = REG_EXTENDED;
-	char	*sbuf;
-	regex_t	 reg;
+	struct window_copy_mode_data	*data = wme->data;
+	struct window_copy_text		*t;
+	u_int				 i, px, sx;
+	int				 found = 0, cflags = REG_EXTENDED;
+	char				*str;
+	size_t				 len;
+	regex_t				 reg;
 
+	str = window_copy_search_needle(sgd, &len);
 	if (regex) {
-		sbuf = xmalloc(ssize);
-		sbuf[0] = '\0';
-		sbuf = window_copy_stringify(sgd, 0, 0, sgd->sx, sbuf, &ssize);
 		if (cis)
 			cflags |= REG_ICASE;
-		if (regcomp(&reg, sbuf, cflags) != 0) {
-			free(sbuf);
+		if (regcomp(&reg, str, cflags) != 0) {
+			free(str);
 			return (0);
 		}
-		free(sbuf);
 	}
 
-	if (direction) {
-		for (i = fy; i <= endline; i++) {
-			if (regex) {
-				found = window_copy_search_lr_regex(gd,
-				    &px, &sx, i, fx, gd->sx, &reg);
-			} else {
-				found = window_copy_search_lr(gd, sgd,
-				    &px, i, fx, gd->sx, cis);
+	if (regex && direction) {
+		/* Regex searches look at a logical line at a time. */
+		for (i = fy; i <= endline; i = t->py + t->ny) {
+			found = window_copy_search_lr_regex(data, &px, &i, &sx,
+			    fx, i, &reg);
+			if (found) {
+				if (i > endline)
+					found = 0;
+				break;
 			}
+			t = window_copy_text_get(data, i);
+			fx = 0;
+		}
+	} else if (regex) {
+		for (i = fy, fx++; ; i = t->py - 1, fx = gd->sx) {
+			found = window_copy_search_rl_regex(data, &px, &i, &sx,
+			    fx, i, &reg);
+			if (found) {
+				if (i < endline)
+					found = 0;
+				break;
+			}
+			t = window_copy_text_get(data, i);
+			if (t->py <= endline)
+				break;
+		}
+	} else if (direction) {
+		for (i = fy; i <= endline; i++) {
+			found = window_copy_search_lr(data, str, len, &px, i,
+			    fx, gd->sx, cis);
 			if (found)
 				break;
 			fx = 0;
 		}
 	} else {
 		for (i = fy + 1; endline < i; i--) {
-			if (regex) {
-				found = window_copy_search_rl_regex(gd,
-				    &px, &sx, i - 1, 0, fx + 1, &reg);
-				if (found) {
-					window_copy_search_back_overlap(gd,
-					    &reg, &px, &sx, &i, endline);
-				}
-			} else {
-				found = window_copy_search_rl(gd, sgd,
-				    &px, i - 1, 0, fx + 1, cis);
-			}
+			found = window_copy_search_rl(data, str, len, &px,
+			    i - 1, 0, fx + 1, cis);
 			if (found) {
 				i--;
 				break;
@@ -3885,6 +4016,7 @@ window_copy_search_jump(struct window_mode_entry *wme, struct grid *gd,
 	}
 	if (regex)
 		regfree(&reg);
+	free(str);
 
 	if (found) {
 		window_copy_scroll_to(wme, px, i, 1);
@@ -3904,12 +4036,12 @@ window_copy_move_after_search_mark(struct window_copy_mode_data *data,
     u_int *fx, u_int *fy, int wrapflag)
 {
 	struct screen  *s = data->backing;
-	u_int		at, start;
+	u_int		mx, my, ax, ay;
 
-	if (window_copy_search_mark_at(data, *fx, *fy, &start) == 0 &&
-	    data->searchmark[start] != 0) {
-		while (window_copy_search_mark_at(data, *fx, *fy, &at) == 0) {
-			if (data->searchmark[at] != data->searchmark[start])
+	if (window_copy_search_mark_at(data, *fx, *fy, &mx, &my, NULL)) {
+		while (window_copy_search_mark_at(data, *fx, *fy, &ax, &ay,
+		    NULL)) {
+			if (ax != mx || ay != my)
 				break;
 			/* Stop if not wrapping and at the end of the grid. */
 			if (!wrapflag &&
@@ -3935,7 +4067,7 @@ window_copy_search(struct window_mode_entry *wme, int direction, int regex)
 	struct screen_write_ctx		 ctx;
 	struct grid			*gd = s->grid;
 	const char			*str = data->searchstr;
-	u_int				 at, endline, fx, fy, start, ssx;
+	u_int				 endline, fx, fy, mx, my, ssx;
 	int				 cis, found, keys, visible_only;
 	int				 wrapflag;
 
@@ -3944,9 +4076,6 @@ window_copy_search(struct window_mode_entry *wme, int direction, int regex)
 
 	data->searchdirection = direction;
 
-	if (data->timeout)
-		return (0);
-
 	if (data->searchall || wp->searchstr == NULL ||
 	    wp->searchregex != regex) {
 		visible_only = 0;
@@ -4013,10 +4142,8 @@ window_copy_search(struct window_mode_entry *wme, int direction, int regex)
 		 * of the mark, search again.
 		 */
 		if (direction &&
-		    window_copy_search_mark_at(data, fx, fy, &at) == 0 &&
-		    at > 0 &&
-		    data->searchmark != NULL &&
-		    data->searchmark[at] == data->searchmark[at - 1]) {
+		    window_copy_search_mark_at(data, fx, fy, &mx, &my, NULL) &&
+		    (mx != fx || my != fy)) {
 			window_copy_move_after_search_mark(data, &fx, &fy,
 			    wrapflag);
 			window_copy_search_jump(wme, gd, ss.grid, fx,
@@ -4041,24 +4168,18 @@ window_copy_search(struct window_mode_entry *wme, int direction, int regex)
 		} else {
 			/*
 			 * When searching backward, position the cursor at the
-			 * beginning of the mark.
+			 * beginning of the mark, or the top of the screen if
+			 * the mark starts above it.
 			 */
-			if (window_copy_search_mark_at(data, fx, fy,
-			        &start) == 0) {
-				while (window_copy_search_mark_at(data, fx, fy,
-				           &at) == 0 &&
-				       data->searchmark != NULL &&
-				       data->searchmark[at] ==
-				           data->searchmark[start]) {
-					data->cx = fx;
-					data->cy = fy -
-					    screen_hsize(data->backing) +
-					    data-> oy;
-					if (at == 0)
-						break;
-
-					window_copy_move_left(s, &fx, &fy, 0);
+			if (window_copy_search_mark_at(data, fx, fy, &mx,
+			    &my, NULL)) {
+				if (my < gd->hsize - data->oy) {
+					mx = 0;
+					my = gd->hsize - data->oy;
 				}
+				data->cx = mx;
+				data->cy = my - screen_hsize(data->backing) +
+				    data->oy;
 			}
 		}
 	}
@@ -4083,183 +4204,296 @@ window_copy_visible_lines(struct window_copy_mode_data *data, u_int *start,
 	*end = gd->hsize - data->oy + gd->sy;
 }
 
+static int
+window_copy_match_cmp(struct window_copy_match_row *r1,
+    struct window_copy_match_row *r2)
+{
+	if (r1->py < r2->py)
+		return (-1);
+	if (r1->py > r2->py)
+		return (1);
+	return (0);
+}
+RB_GENERATE_STATIC(window_copy_match_rows, window_copy_match_row, entry,
+    window_copy_match_cmp);
+
+/*
+ * Find the match covering a cell, if any, and return where it starts and its
+ * width.
+ */
 static int
 window_copy_search_mark_at(struct window_copy_mode_data *data, u_int px,
-    u_int py, u_int *at)
+    u_int py, u_int *mx, u_int *my, u_int *mw)
 {
-	struct screen	*s = data->backing;
-	struct grid	*gd = s->grid;
+	struct window_copy_marks	*m = data->searchmark;
+	struct window_copy_match_row	 find, *row;
+	struct window_copy_match	*wcm;
+	u_int				 sx = screen_size_x(data->backing);
+	u_int				 i, offset;
 
-	if (py < gd->hsize - data->oy)
-		return (-1);
-	if (py > gd->hsize - data->oy + gd->sy - 1)
-		return (-1);
-	*at = ((py - (gd->hsize - data->oy)) * gd->sx) + px;
+	if (m == NULL)
+		return (0);
+
+	find.py = py;
+	row = RB_NFIND(window_copy_match_rows, &m->rows, &find);
+	if (row == NULL)
+		row = RB_MAX(window_copy_match_rows, &m->rows);
+	else if (row->py != py)
+		row = RB_PREV(window_copy_match_rows, &m->rows, row);
+
+	/*
+	 * Look back through the rows until a match starts before the cell or
+	 * the rows are too far away for any match to reach it.
+	 */
+	for (; row != NULL; row = RB_PREV(window_copy_match_rows, &m->rows,
+	    row)) {
+		if (py - row->py > m->maxwidth / sx + 1)
+			break;
+		offset = (py - row->py) * sx + px;
+		for (i = row->n; i > 0; i--) {
+			wcm = &row->list[i - 1];
+			if (wcm->px > offset)
+				continue;
+			if (offset >= wcm->px + wcm->width)
+				return (0);
+			*mx = wcm->px;
+			*my = row->py;
+			if (mw != NULL)
+				*mw = wcm->width;
+			return (1);
+		}
+	}
 	return (0);
 }
 
-static u_int
-window_copy_clip_width(u_int width, u_int b, u_int sx, u_int sy)
+/* Add a match. Matches must be added in order within a logical line. */
+static void
+window_copy_search_mark_add(struct window_copy_marks *m, u_int px, u_int py,
+    u_int width)
 {
-	return ((b + width > sx * sy) ? (sx * sy) - b : width);
+	struct window_copy_match_row	*row = m->last;
+
+	if (row == NULL || row->py != py) {
+		row = xcalloc(1, sizeof *row);
+		row->py = py;
+		RB_INSERT(window_copy_match_rows, &m->rows, row);
+		m->last = row;
+	}
+	row->list = xreallocarray(row->list, row->n + 1, sizeof *row->list);
+	row->list[row->n].px = px;
+	row->list[row->n].width = width;
+	row->n++;
+
+	m->nfound++;
+	if (width > m->maxwidth)
+		m->maxwidth = width;
 }
 
+/* Get the width of a plain text match, allowing for tabs. */
 static u_int
-window_copy_search_mark_match(struct window_copy_mode_data *data, u_int px,
-    u_int py, u_int width, int regex)
+window_copy_search_mark_width(struct grid *gd, u_int px, u_int py,
+    u_int width)
 {
-	struct grid		*gd = data->backing->grid;
-	struct grid_cell	 gc;
-	u_int			 i, b, w = width, sx = gd->sx, sy = gd->sy;
-
-	if (window_copy_search_mark_at(data, px, py, &b) == 0) {
-		width = window_copy_clip_width(width, b, sx, sy);
-		w = width;
-		for (i = b; i < b + w; i++) {
-			if (!regex) {
-				grid_get_cell(gd, px + (i - b), py, &gc);
-				if (gc.flags & GRID_FLAG_TAB)
-					w += gc.data.width - 1;
-				w = window_copy_clip_width(w, b, sx, sy);
+	struct grid_cell	gc;
+	u_int			i, x = px, y = py, endline;
+
+	endline = gd->hsize + gd->sy - 1;
+	for (i = 0; i < width; i++) {
+		grid_get_cell(gd, x, y, &gc);
+		if (gc.flags & GRID_FLAG_TAB)
+			width += gc.data.width - 1;
+		if (++x == gd->sx) {
+			if (y == endline) {
+				width = i + 1;
+				break;
 			}
-			if (data->searchmark[i] != 0)
-				continue;
-			data->searchmark[i] = data->searchgen;
+			x = 0;
+			y++;
 		}
-		if (data->searchgen == UCHAR_MAX)
-			data->searchgen = 1;
-		else
-			data->searchgen++;
 	}
+	return (width);
+}
+
+/* Search the logical line containing a row and mark the matches. */
+static void
+window_copy_search_mark_line(struct window_copy_mode_data *data, u_int py)
+{
+	struct window_copy_marks	*m = data->searchmark;
+	struct grid			*gd = data->backing->grid;
+	u_int				 start, end, px, nx = 0, ny = 0, width;
+	u_int				 sx = gd->sx;
+
+	for (start = py; start > 0; start--) {
+		if (~grid_peek_line(gd, start - 1)->flags & GRID_LINE_WRAPPED)
+			break;
+	}
+	for (end = py; end < m->lines - 1; end++) {
+		if (~grid_peek_line(gd, end)->flags & GRID_LINE_WRAPPED)
+			break;
+	}
+	m->last = NULL;
 
-	return (w);
+	/*
+	 * Search from the end of the last match, which may have run on from an
+	 * earlier row. Regex searches find every match in the line at once.
+	 */
+	if (m->regex) {
+		px = 0;
+		py = start;
+		while (py <= end && window_copy_search_lr_regex(data, &px, &py,
+		    &width, px, py, &m->reg)) {
+			window_copy_search_mark_add(m, px, py, width);
+			py += (px + width) / sx;
+			px = (px + width) % sx;
+		}
+		bit_nset(m->done, start, end);
+		return;
+	}
+	for (py = start; py <= end; py++) {
+		if (ny > py)
+			continue;
+		px = (ny == py) ? nx : 0;
+		while (px < sx) {
+			if (!window_copy_search_lr(data, m->str, m->len, &px,
+			    py, px, sx, m->cis))
+				break;
+			width = window_copy_search_mark_width(gd, px, py,
+			    m->width);
+			window_copy_search_mark_add(m, px, py, width);
+
+			nx = (px + width) % sx;
+			ny = py + (px + width) / sx;
+			if (ny != py)
+				break;
+			px = nx;
+		}
+	}
+	bit_nset(m->done, start, end);
+}
+
+/*
+ * Move the search on to the next unsearched lines above and below. Returns 0
+ * if there are none left.
+ */
+static int
+window_copy_search_mark_next(struct window_copy_mode_data *data, int search)
+{
+	struct window_copy_marks	*m = data->searchmark;
+
+	while (m->down < m->lines && bit_test(m->done, m->down))
+		m->down++;
+	while (m->up > 0 && bit_test(m->done, m->up - 1))
+		m->up--;
+	if (m->up == 0 && m->down == m->lines)
+		return (0);
+	if (search) {
+		if (m->down < m->lines)
+			window_copy_search_mark_line(data, m->down);
+		if (m->up > 0)
+			window_copy_search_mark_line(data, m->up - 1);
+	}
+	return (1);
+}
+
+/* Update the match count and start the timer if there is more to search. */
+static void
+window_copy_search_mark_update(struct window_copy_mode_data *data)
+{
+	struct window_copy_marks	*m = data->searchmark;
+	struct timeval			 tv = { 0 };
+
+	data->searchcount = m->nfound;
+	data->searchmore = window_copy_search_mark_next(data, 0);
+	if (data->searchmore && !evtimer_pending(&m->timer, NULL))
+		evtimer_add(&m->timer, &tv);
+}
+
+/* Search some more lines and update the indicator. */
+static void
+window_copy_search_timer(__unused int fd, __unused short events, void *arg)
+{
+	struct window_mode_entry	*wme = arg;
+	struct window_pane		*wp = wme->wp;
+	struct window_copy_mode_data	*data = wme->data;
+	uint64_t			 stop;
+
+	stop = get_timer() + WINDOW_COPY_SEARCH_SLICE;
+	while (window_copy_search_mark_next(data, 1)) {
+		if (get_timer() >= stop)
+			break;
+	}
+	window_copy_search_mark_update(data);
+
+	if (TAILQ_FIRST(&wp->modes) == wme)
+		window_copy_redraw_lines(wme, 0, 1);
 }
 
+/*
+ * Mark the search matches. If visible_only is set and there are marks already,
+ * just make sure the visible lines have been searched; otherwise start again.
+ */
 static int
 window_copy_search_marks(struct window_mode_entry *wme, struct screen *ssp,
     int regex, int visible_only)
 {
 	struct window_copy_mode_data	*data = wme->data;
+	struct window_copy_marks	*m = data->searchmark;
 	struct screen			*s = data->backing, ss;
 	struct screen_write_ctx		 ctx;
 	struct grid			*gd = s->grid;
-	struct grid_cell		 gc;
-	int				 found, cis, stopped = 0;
 	int				 cflags = REG_EXTENDED;
-	u_int				 px, py, nfound = 0, width;
-	u_int				 ssize = 1, start, end, sx = gd->sx;
-	u_int				 sy = gd->sy;
-	char				*sbuf;
-	regex_t				 reg;
-	uint64_t			 stop = 0, tstart, t;
-
-	if (ssp == NULL) {
-		width = screen_write_strlen("%s", data->searchstr);
-		screen_init(&ss, width, 1, 0);
-		screen_write_start(&ctx, &ss);
-		screen_write_nputs(&ctx, -1, &grid_default_cell, "%s",
-		    data->searchstr);
-		screen_write_stop(&ctx);
-		ssp = &ss;
-	} else
-		width = screen_size_x(ssp);
+	u_int				 py, start, end;
 
-	cis = window_copy_is_lowercase(data->searchstr);
+	if (m == NULL || !visible_only) {
+		window_copy_clear_marks(wme);
 
-	if (regex) {
-		sbuf = xmalloc(ssize);
-		sbuf[0] = '\0';
-		sbuf = window_copy_stringify(ssp->grid, 0, 0, ssp->grid->sx,
-		    sbuf, &ssize);
-		if (cis)
-			cflags |= REG_ICASE;
-		if (regcomp(&reg, sbuf, cflags) != 0) {
-			free(sbuf);
-			return (0);
+		if (ssp == NULL) {
+			screen_init(&ss, screen_write_strlen("%s",
+			    data->searchstr), 1, 0);
+			screen_write_start(&ctx, &ss);
+			screen_write_nputs(&ctx, -1, &grid_default_cell, "%s",
+			    data->searchstr);
+			screen_write_stop(&ctx);
+			ssp = &ss;
 		}
-		free(sbuf);
-	}
-	tstart = get_timer();
 
-	if (visible_only)
-		window_copy_visible_lines(data, &start, &end);
-	else {
-		start = 0;
-		end = gd->hsize + sy;
-		stop = get_timer() + WINDOW_COPY_SEARCH_ALL_TIMEOUT;
-	}
-
-again:
-	free(data->searchmark);
-	data->searchmark = xcalloc(sx, sy);
-	data->searchgen = 1;
-
-	for (py = start; py < end; py++) {
-		px = 0;
-		for (;;) {
-			if (regex) {
-				found = window_copy_search_lr_regex(gd,
-				    &px, &width, py, px, sx, &reg);
-				grid_get_cell(gd, px + width - 1, py, &gc);
-				if (gc.data.width > 2)
-					width += gc.data.width - 1;
-				if (!found)
-					break;
-			} else {
-				found = window_copy_search_lr(gd, ssp->grid,
-				    &px, py, px, sx, cis);
-				if (!found)
-					break;
+		m = xcalloc(1, sizeof *m);
+		m->regex = regex;
+		m->width = screen_size_x(ssp);
+		m->cis = window_copy_is_lowercase(data->searchstr);
+		m->str = window_copy_search_needle(ssp->grid, &m->len);
+		if (ssp == &ss)
+			screen_free(&ss);
+		if (regex) {
+			if (m->cis)
+				cflags |= REG_ICASE;
+			if (regcomp(&m->reg, m->str, cflags) != 0) {
+				free(m->str);
+				free(m);
+				return (0);
 			}
-			nfound++;
-			px += window_copy_search_mark_match(data, px, py, width,
-			    regex);
 		}
 
-		t = get_timer();
-		if (t - tstart > WINDOW_COPY_SEARCH_TIMEOUT) {
-			data->timeout = 1;
-			break;
-		}
-		if (stop != 0 && t > stop) {
-			stopped = 1;
-			break;
-		}
-	}
-	if (data->timeout) {
-		window_copy_clear_marks(wme);
-		goto out;
-	}
-
-	if (stopped && stop != 0) {
-		/* Try again but just the visible context. */
-		window_copy_visible_lines(data, &start, &end);
-		stop = 0;
-		goto again;
+		RB_INIT(&m->rows);
+		m->lines = gd->hsize + gd->sy;
+		if ((m->done = bit_alloc(m->lines)) == NULL)
+			fatal("bit_alloc failed");
+		evtimer_set(&m->timer, window_copy_search_timer, wme);
+		data->searchmark = m;
 	}
 
-	if (!visible_only) {
-		if (stopped) {
-			if (nfound > 1000)
-				data->searchcount = 1000;
-			else if (nfound > 100)
-				data->searchcount = 100;
-			else if (nfound > 10)
-				data->searchcount = 10;
-			else
-				data->searchcount = -1;
-			data->searchmore = 1;
-		} else {
-			data->searchcount = nfound;
-			data->searchmore = 0;
-		}
+	/* Search the visible lines now and the rest from there outwards. */
+	window_copy_visible_lines(data, &start, &end);
+	if (end > m->lines)
+		end = m->lines;
+	for (py = start; py < end; py++) {
+		if (!bit_test(m->done, py))
+			window_copy_search_mark_line(data, py);
 	}
+	m->up = start;
+	m->down = end;
+	window_copy_search_mark_update(data);
 
-out:
-	if (ssp == &ss)
-		screen_free(&ss);
-	if (regex)
-		regfree(&reg);
 	return (1);
 }
 
@@ -4267,9 +4501,30 @@ static void
 window_copy_clear_marks(struct window_mode_entry *wme)
 {
 	struct window_copy_mode_data	*data = wme->data;
+	struct window_copy_marks	*m = data->searchmark;
+	struct window_copy_match_row	*row, *row1;
 
-	free(data->searchmark);
+	if (m == NULL)
+		return;
 	data->searchmark = NULL;
+
+	/* If the search was not finished, the count is no use. */
+	if (data->searchmore) {
+		data->searchcount = -1;
+		data->searchmore = 0;
+	}
+
+	evtimer_del(&m->timer);
+	RB_FOREACH_SAFE(row, window_copy_match_rows, &m->rows, row1) {
+		RB_REMOVE(window_copy_match_rows, &m->rows, row);
+		free(row->list);
+		free(row);
+	}
+	free(m->done);
+	if (m->regex)
+		regfree(&m->reg);
+	free(m->str);
+	free(m);
 }
 
 static int
@@ -4302,32 +4557,12 @@ window_copy_goto_line(struct window_mode_entry *wme, const char *linestr)
 	window_copy_redraw_screen(wme);
 }
 
-static void
-window_copy_match_start_end(struct window_copy_mode_data *data, u_int at,
-    u_int *start, u_int *end)
-{
-	struct grid	*gd = data->backing->grid;
-	u_int		 last = (gd->sy * gd->sx) - 1;
-	u_char		 mark = data->searchmark[at];
-
-	*start = *end = at;
-	while (*start != 0 && data->searchmark[*start] == mark)
-		(*start)--;
-	if (data->searchmark[*start] != mark)
-		(*start)++;
-	while (*end != last && data->searchmark[*end] == mark)
-		(*end)++;
-	if (data->searchmark[*end] != mark)
-		(*end)--;
-}
-
 static char *
 window_copy_match_at_cursor(struct window_copy_mode_data *data)
 {
 	struct grid	*gd = data->backing->grid;
 	struct grid_cell gc;
-	u_int		 at, start, end, cy, px, py;
-	u_int		 sx = screen_size_x(data->backing);
+	u_int		 i, width, cy, px, py;
 	char		*buf = NULL;
 	size_t		 len = 0;
 
@@ -4335,24 +4570,27 @@ window_copy_match_at_cursor(struct window_copy_mode_data *data)
 		return (NULL);
 
 	cy = screen_hsize(data->backing) - data->oy + data->cy;
-	if (window_copy_search_mark_at(data, data->cx, cy, &at) != 0)
-		return (NULL);
-	if (data->searchmark[at] == 0) {
+	if (!window_copy_search_mark_at(data, data->cx, cy, &px, &py,
+	    &width)) {
 		/* Allow one position after the match. */
-		if (at == 0 || data->searchmark[--at] == 0)
+		if (data->cx != 0)
+			i = window_copy_search_mark_at(data, data->cx - 1, cy,
+			    &px, &py, &width);
+		else if (cy != 0)
+			i = window_copy_search_mark_at(data, gd->sx - 1,
+			    cy - 1, &px, &py, &width);
+		else
+			i = 0;
+		if (!i)
 			return (NULL);
 	}
-	window_copy_match_start_end(data, at, &start, &end);
 
 	/*
-	 * Cells will not be set in the marked array unless they are valid text
-	 * and wrapping will be taken care of, so we can just copy.
- 	 */
-	for (at = start; at <= end; at++) {
-		py = at / sx;
-		px = at - (py * sx);
-
-		grid_get_cell(gd, px, gd->hsize + py - data->oy, &gc);
+	 * Cells will not be marked unless they are valid text and wrapping
+	 * will be taken care of, so we can just copy.
+	 */
+	for (i = 0; i < width; i++) {
+		grid_get_cell(gd, px, py, &gc);
 		if (gc.flags & GRID_FLAG_TAB) {
 			buf = xrealloc(buf, len + 2);
 			buf[len] = '\t';
@@ -4364,6 +4602,10 @@ window_copy_match_at_cursor(struct window_copy_mode_data *data)
 			memcpy(buf + len, gc.data.data, gc.data.size);
 			len += gc.data.size;
 		}
+		if (++px == gd->sx) {
+			px = 0;
+			py++;
+		}
 	}
 	if (len != 0)
 		buf[len] = '\0';
@@ -4377,9 +4619,8 @@ window_copy_update_style(struct window_mode_entry *wme, u_int fx, u_int fy,
 {
 	struct window_pane		*wp = wme->wp;
 	struct window_copy_mode_data	*data = wme->data;
-	u_int				 mark, start, end, cy, cursor, current;
-	int				 inv = 0, found = 0;
-	int				 keys;
+	u_int				 mx, my, cx, cy, sx, sy;
+	int				 inv = 0, keys;
 
 	if (data->showmark && fy == data->my) {
 		gc->attr = mkgc->attr;
@@ -4398,40 +4639,38 @@ window_copy_update_style(struct window_mode_entry *wme, u_int fx, u_int fy,
 	if (data->searchmark == NULL)
 		return;
 
-	if (window_copy_search_mark_at(data, fx, fy, &current) != 0)
-		return;
-	mark = data->searchmark[current];
-	if (mark == 0)
+	if (!window_copy_search_mark_at(data, fx, fy, &mx, &my, NULL))
 		return;
 
+	/*
+	 * The current match is the one at the cursor or, in emacs mode after
+	 * searching forward, the one just before it.
+	 */
+	cx = data->cx;
 	cy = screen_hsize(data->backing) - data->oy + data->cy;
-	if (window_copy_search_mark_at(data, data->cx, cy, &cursor) == 0) {
-		keys = options_get_number(wp->window->options, "mode-keys");
-		if (cursor != 0 &&
-		    keys == MODEKEY_EMACS &&
-		    data->searchdirection) {
-			if (data->searchmark[cursor - 1] == mark) {
-				cursor--;
-				found = 1;
-			}
-		} else if (data->searchmark[cursor] == mark)
-			found = 1;
-		if (found) {
-			window_copy_match_start_end(data, cursor, &start, &end);
-			if (current >= start && current <= end) {
-				gc->attr = cgc->attr;
-				if (inv) {
-					gc->fg = cgc->bg;
-					gc->bg = cgc->fg;
-				}
-				else {
-					gc->fg = cgc->fg;
-					gc->bg = cgc->bg;
-				}
-				return;
-			}
+	keys = options_get_number(wp->window->options, "mode-keys");
+	if (keys == MODEKEY_EMACS && data->searchdirection) {
+		if (cx != 0)
+			cx--;
+		else if (cy != 0) {
+			cx = screen_size_x(data->backing) - 1;
+			cy--;
 		}
 	}
+	if (window_copy_search_mark_at(data, cx, cy, &sx, &sy, NULL) &&
+	    sx == mx &&
+	    sy == my) {
+		gc->attr = cgc->attr;
+		if (inv) {
+			gc->fg = cgc->bg;
+			gc->bg = cgc->fg;
+		}
+		else {
+			gc->fg = cgc->fg;
+			gc->bg = cgc->bg;
+		}
+		return;
+	}
 
 	gc->attr = mgc->attr;
 	if (inv) {
@@ -5734,7 +5973,7 @@ window_copy_scroll_up(struct window_mode_entry *wme, u_int ny)
 		return;
 	data->oy -= ny;
 
-	if (data->searchmark != NULL && !data->timeout)
+	if (data->searchmark != NULL)
 		window_copy_search_marks(wme, NULL, data->searchregex, 1);
 	window_copy_update_selection(wme, 0, 0);
 
@@ -5771,7 +6010,7 @@ window_copy_scroll_down(struct window_mode_entry *wme, u_int ny)
 		return;
 	data->oy += ny;
 
-	if (data->searchmark != NULL && !data->timeout)
+	if (data->searchmark != NULL)
 		window_copy_search_marks(wme, NULL, data->searchregex, 1);
 	window_copy_update_selection(wme, 0, 0);
 
@@ -1274,6 +1274,36 @@ window_pane_visible(struct window_pane *wp)
 	return (wp == wp->window->active);
 }
 
+/*
+ * Count the attached clients showing each window. This is updated when
+ * clients attach or detach or sessions change window.
+ */
+void
+window_update_observers(void)
+{
+	struct window	*w;
+	struct client	*c;
+
+	RB_FOREACH(w, windows, &windows)
+		w->observers = 0;
+	TAILQ_FOREACH(c, &clients, entry) {
+		if (c->session == NULL || c->session->curw == NULL)
+			continue;
+		if (c->flags & (CLIENT_CONTROL|CLIENT_UNATTACHEDFLAGS))
+			continue;
+		c->session->curw->window->observers++;
+	}
+}
+
+/* Is a pane on the screen of any client? */
+int
+window_pane_observed(struct window_pane *wp)
+{
+	if (wp->window->observers == 0)
+		return (0);
+	return (wp->layout_cell != NULL);
+}
+
 int
 window_pane_exited(struct window_pane *wp)
 {